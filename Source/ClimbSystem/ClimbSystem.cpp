@@ -3,5 +3,47 @@
 #include "ClimbSystem.h"
 #include "Modules/ModuleManager.h"
 
-IMPLEMENT_PRIMARY_GAME_MODULE( FDefaultGameModuleImpl, ClimbSystem, "ClimbSystem" );
- 
\ No newline at end of file
+#if WITH_GAMEPLAY_DEBUGGER
+#include "GameplayDebugger.h"
+#include "GameplayDebuggerCategory_Climb.h"
+#endif
+
+DEFINE_LOG_CATEGORY(LogClimb);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+DECLARE_LLM_MEMORY_STAT(TEXT("Climb"), STAT_ClimbLLM, STATGROUP_LLMFULL);
+DECLARE_LLM_MEMORY_STAT(TEXT("Climb"), STAT_ClimbSummaryLLM, STATGROUP_LLM);
+#endif
+
+class FClimbSystemModule : public FDefaultGameModuleImpl
+{
+public:
+
+	virtual void StartupModule() override
+	{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+		FLowLevelMemTracker::Get().RegisterProjectTag((int32)ELLMTagClimb::Climb, TEXT("Climb"), GET_STATFNAME(STAT_ClimbLLM), GET_STATFNAME(STAT_ClimbSummaryLLM));
+#endif
+
+#if WITH_GAMEPLAY_DEBUGGER
+		IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+		GameplayDebugger.RegisterCategory("Climb", IGameplayDebugger::FOnGetCategory::CreateStatic(&FGameplayDebuggerCategory_Climb::MakeInstance),
+			EGameplayDebuggerCategoryState::EnabledInGameAndSimulate);
+		GameplayDebugger.NotifyCategoriesChanged();
+#endif
+	}
+
+	virtual void ShutdownModule() override
+	{
+#if WITH_GAMEPLAY_DEBUGGER
+		if (IGameplayDebugger::IsAvailable())
+		{
+			IGameplayDebugger& GameplayDebugger = IGameplayDebugger::Get();
+			GameplayDebugger.UnregisterCategory("Climb");
+			GameplayDebugger.NotifyCategoriesChanged();
+		}
+#endif
+	}
+};
+
+IMPLEMENT_PRIMARY_GAME_MODULE( FClimbSystemModule, ClimbSystem, "ClimbSystem" );
@@ -3,3 +3,24 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "HAL/LowLevelMemTracker.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogClimb, Log, All);
+
+DECLARE_STATS_GROUP(TEXT("Climb"), STATGROUP_Climb, STATCAT_Advanced);
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+
+/* Climb memory in the LLM reports, registered when the module starts*/
+enum class ELLMTagClimb : LLM_TAG_TYPE
+{
+	Climb = (LLM_TAG_TYPE)ELLMTag::ProjectTagStart
+};
+
+#define LLM_SCOPE_CLIMB() LLM_SCOPE((ELLMTag)ELLMTagClimb::Climb)
+
+#else
+
+#define LLM_SCOPE_CLIMB()
+
+#endif
@@ -0,0 +1,70 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbAIController.h"
+#include "ClimbNavLinks.h"
+#include "ClimbSystemCharacter.h"
+#include "NavigationData.h"
+
+AClimbAIController::AClimbAIController(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer.SetDefaultSubobjectClass<UClimbPathFollowingComponent>(TEXT("PathFollowingComponent")))
+{
+}
+
+void UClimbPathFollowingComponent::SetMoveSegment(int32 SegmentStartIndex)
+{
+	Super::SetMoveSegment(SegmentStartIndex);
+
+	bClimbTraversal = false;
+
+	if (!Path.IsValid() || !Path->GetPathPoints().IsValidIndex(SegmentStartIndex + 1))
+		return;
+
+	const FNavPathPoint& SegmentStart	= Path->GetPathPoints()[SegmentStartIndex];
+	const FNavPathPoint& SegmentEnd		= Path->GetPathPoints()[SegmentStartIndex + 1];
+
+	//Climb links are plain nav links, so they are found again by where they start and end.
+	if (!FNavMeshNodeFlags(SegmentStart.Flags).IsNavLink())
+		return;
+
+	AClimbSystemCharacter* Climber = GetClimber();
+	if (!Climber)
+		return;
+
+	if (const FClimbTraversal* Traversal = AClimbNavLinks::FindTraversalInWorld(GetWorld(), SegmentStart.Location, SegmentEnd.Location))
+		bClimbTraversal = Climber->ExecuteClimbTraversal(*Traversal);
+}
+
+void UClimbPathFollowingComponent::FollowPathSegment(float DeltaTime)
+{
+	//The climber moves itself through the link.
+	if (IsClimbing())
+		return;
+
+	Super::FollowPathSegment(DeltaTime);
+}
+
+bool UClimbPathFollowingComponent::HasReachedCurrentTarget(const FVector& CurrentLocation) const
+{
+	if (IsClimbing())
+		return false;
+
+	return Super::HasReachedCurrentTarget(CurrentLocation);
+}
+
+AClimbSystemCharacter* UClimbPathFollowingComponent::GetClimber() const
+{
+	const AController* OwnerController = Cast<AController>(GetOwner());
+	return OwnerController ? Cast<AClimbSystemCharacter>(OwnerController->GetPawn()) : nullptr;
+}
+
+bool UClimbPathFollowingComponent::IsClimbing() const
+{
+	if (!bClimbTraversal)
+		return false;
+
+	const AClimbSystemCharacter* Climber = GetClimber();
+	return Climber && Climber->IsClimbTraversalActive();
+}
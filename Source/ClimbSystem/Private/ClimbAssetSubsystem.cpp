@@ -0,0 +1,132 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbAssetSubsystem.h"
+#include "ClimbSystem.h"
+#include "ClimbSystemCharacter.h"
+#include "Misc/CommandLine.h"
+
+void UClimbAssetSubsystem::Initialize(FSubsystemCollection& Collection)
+{
+	Super::Initialize(Collection);
+	bSyncLoad = FParse::Param(FCommandLine::Get(), TEXT("ClimbSyncLoad"));
+}
+
+void UClimbAssetSubsystem::Deinitialize()
+{
+	for (TPair<FName, FClimbAssetRequest>& Request : Requests)
+	{
+		if (Request.Value.Handle.IsValid())
+			Request.Value.Handle->CancelHandle();
+	}
+
+	for (TSharedPtr<FStreamableHandle>& Handle : ClassHandles)
+		Handle->CancelHandle();
+
+	Requests.Empty();
+	ClassHandles.Empty();
+
+	Super::Deinitialize();
+}
+
+void UClimbAssetSubsystem::RequestClimberClass(const TSoftClassPtr<APawn>& ClimberClass, FSimpleDelegate OnLoaded)
+{
+	LLM_SCOPE_CLIMB();
+
+	const double RequestTime = FPlatformTime::Seconds();
+
+	if (bSyncLoad)
+	{
+		ClimberClass.LoadSynchronous();
+		OnClimberClassLoaded(ClimberClass, OnLoaded, RequestTime);
+		return;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = Streamable.RequestAsyncLoad(ClimberClass.ToSoftObjectPath(),
+		FStreamableDelegate::CreateUObject(this, &UClimbAssetSubsystem::OnClimberClassLoaded, ClimberClass, OnLoaded, RequestTime),
+		FStreamableManager::AsyncLoadHighPriority, true);
+
+	if (Handle.IsValid())
+		ClassHandles.Add(Handle);
+}
+
+void UClimbAssetSubsystem::OnClimberClassLoaded(TSoftClassPtr<APawn> ClimberClass, FSimpleDelegate OnLoaded, double RequestTime)
+{
+	UClass* LoadedClass = ClimberClass.Get();
+
+	UE_LOG(LogClimb, Log, TEXT("Climb assets: %s %s in %.1f ms"), *ClimberClass.ToString(),
+		LoadedClass ? TEXT("loaded") : TEXT("failed to load"), (FPlatformTime::Seconds() - RequestTime) * 1000.0);
+
+	//The montages start streaming before the pawn spawns, so they are usually in by the time it reaches a wall.
+	if (LoadedClass)
+		RequestClimbAssets(LoadedClass, FSimpleDelegate());
+
+	OnLoaded.ExecuteIfBound();
+}
+
+bool UClimbAssetSubsystem::RequestClimbAssets(UClass* ClimberClass, FSimpleDelegate OnLoaded)
+{
+	LLM_SCOPE_CLIMB();
+
+	const AClimbSystemCharacter* DefaultClimber = ClimberClass ? Cast<AClimbSystemCharacter>(ClimberClass->GetDefaultObject()) : nullptr;
+	if (!DefaultClimber)
+		return true;
+
+	const FName ClassName = *ClimberClass->GetPathName();
+
+	if (FClimbAssetRequest* Request = Requests.Find(ClassName))
+	{
+		if (Request->bLoaded)
+			return true;
+
+		Request->WaitingClimbers.Add(OnLoaded);
+		return false;
+	}
+
+	TArray<FSoftObjectPath> AssetPaths;
+	DefaultClimber->GetClimbAssetPaths(AssetPaths);
+
+	FClimbAssetRequest& Request = Requests.Add(ClassName);
+	Request.RequestTime			= FPlatformTime::Seconds();
+	Request.NumAssets			= AssetPaths.Num();
+
+	if (AssetPaths.Num() == 0)
+	{
+		Request.bLoaded = true;
+		return true;
+	}
+
+	if (bSyncLoad)
+	{
+		Request.Handle = Streamable.RequestSyncLoad(AssetPaths, true);
+		OnClimbAssetsLoaded(ClassName);
+		return true;
+	}
+
+	Request.WaitingClimbers.Add(OnLoaded);
+	Request.Handle = Streamable.RequestAsyncLoad(AssetPaths, FStreamableDelegate::CreateUObject(this, &UClimbAssetSubsystem::OnClimbAssetsLoaded, ClassName),
+		FStreamableManager::AsyncLoadHighPriority, true);
+
+	//Everything was in memory already and the delegate ran right away.
+	return Requests.FindChecked(ClassName).bLoaded;
+}
+
+void UClimbAssetSubsystem::OnClimbAssetsLoaded(FName ClassName)
+{
+	FClimbAssetRequest* Request = Requests.Find(ClassName);
+	if (!Request || Request->bLoaded)
+		return;
+
+	Request->bLoaded = true;
+
+	UE_LOG(LogClimb, Log, TEXT("Climb assets: %d for %s %s in %.1f ms, %.1f ms after engine start"), Request->NumAssets, *ClassName.ToString(),
+		bSyncLoad ? TEXT("loaded synchronously") : TEXT("streamed"), (FPlatformTime::Seconds() - Request->RequestTime) * 1000.0,
+		(FPlatformTime::Seconds() - GStartTime) * 1000.0);
+
+	const TArray<FSimpleDelegate> WaitingClimbers = MoveTemp(Request->WaitingClimbers);
+
+	for (const FSimpleDelegate& OnLoaded : WaitingClimbers)
+		OnLoaded.ExecuteIfBound();
+}
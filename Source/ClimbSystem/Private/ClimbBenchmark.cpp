@@ -0,0 +1,183 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbSystem.h"
+#include "ClimbSystemCharacter.h"
+#include "ClimbSettings.h"
+#include "ClimbNavLinks.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "NavigationSystem.h"
+#include "NavMesh/RecastNavMesh.h"
+
+/*
+ * Headless probe benchmark. Runs every climb probe of every climber in the world with each probe mode
+ * and each climb.ProbeQuality tier, times telemetry recording and the climb snapshot, and checks that restoring a snapshot gives the same snapshot back.
+ * UE4Editor ClimbSystem <Map> -game -nullrhi -ExecCmds="climb.Benchmark 1000"
+ */
+static void RunClimbBenchmark(const TArray<FString>& Args, UWorld* World)
+{
+	const int32 Iterations = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 1000;
+
+	int32 NumClimbers				= 0;
+	int32 NumSensingClimbers		= 0;
+	double PerProbeMilliseconds		= 0.0;
+	double BroadPhaseMilliseconds	= 0.0;
+	double SavedMilliseconds		= 0.0;
+	double SnapshotMilliseconds		= 0.0;
+	double TelemetryMilliseconds	= 0.0;
+
+	const int32 NumTiers		= FClimbProbeSettings::GetNumQualityTiers();
+	const int32 PreviousTier	= FClimbProbeSettings::GetQualityTier();
+
+	//Tiers are switched with the priority the current one was set with, so they take effect and the old tier comes back the same way.
+	const EConsoleVariableFlags TierSetBy = FClimbProbeSettings::GetQualityTierSetBy();
+
+	TArray<double> TierMilliseconds;
+	TierMilliseconds.SetNumZeroed(NumTiers);
+	int32 RoundTripFailures			= 0;
+
+	for (TActorIterator<AClimbSystemCharacter> It(World); It; ++It)
+	{
+		const double PerProbeCost	= It->MeasureClimbProbeCost(EClimbProbeMode::PerProbe, Iterations);
+		const double BroadPhaseCost	= It->MeasureClimbProbeCost(EClimbProbeMode::BroadPhase, Iterations);
+
+		PerProbeMilliseconds	+= PerProbeCost;
+		BroadPhaseMilliseconds	+= BroadPhaseCost;
+		NumClimbers++;
+
+		//Climbers away from climbable volumes skip the climb in Tick, so their probes are never paid for.
+		if (It->IsClimbSensingActive())
+			NumSensingClimbers++;
+		else
+			SavedMilliseconds += It->ProbeMode == EClimbProbeMode::BroadPhase ? BroadPhaseCost : PerProbeCost;
+
+		TelemetryMilliseconds += It->MeasureClimbTelemetryCost(Iterations);
+
+		//Each tier runs with the climber's own probe mode, like it would in game.
+		for (int32 Tier = 0; Tier < NumTiers; Tier++)
+		{
+			FClimbProbeSettings::SetQualityTier(Tier, TierSetBy);
+			TierMilliseconds[Tier] += It->MeasureClimbProbeCost(It->ProbeMode, Iterations);
+		}
+
+		FClimbProbeSettings::SetQualityTier(PreviousTier, TierSetBy);
+
+		FClimbSnapshot Snapshot;
+		const uint64 SnapshotStartCycles = FPlatformTime::Cycles64();
+
+		for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+			It->SaveClimbSnapshot(Snapshot);
+
+		SnapshotMilliseconds += FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - SnapshotStartCycles) / Iterations;
+
+		//Restoring lands transitions in flight, so only settled states are expected to come back unchanged.
+		if (Snapshot.Transition == EClimbTransition::None)
+		{
+			FClimbSnapshot RestoredSnapshot;
+			It->RestoreClimbSnapshot(Snapshot);
+			It->SaveClimbSnapshot(RestoredSnapshot);
+
+			if (!Snapshot.Equals(RestoredSnapshot, 0.01f))
+				RoundTripFailures++;
+		}
+	}
+
+	if (NumClimbers == 0)
+	{
+		UE_LOG(LogClimb, Warning, TEXT("climb.Benchmark: no climbers in the world"));
+		return;
+	}
+
+	UE_LOG(LogClimb, Display, TEXT("climb.Benchmark: %d climbers, %d iterations"), NumClimbers, Iterations);
+	UE_LOG(LogClimb, Display, TEXT("  PerProbe   : %.4f ms per frame for all climbers, %.2f us per climber"), PerProbeMilliseconds, PerProbeMilliseconds * 1000.0 / NumClimbers);
+	UE_LOG(LogClimb, Display, TEXT("  BroadPhase : %.4f ms per frame for all climbers, %.2f us per climber"), BroadPhaseMilliseconds, BroadPhaseMilliseconds * 1000.0 / NumClimbers);
+	UE_LOG(LogClimb, Display, TEXT("  Sensing    : %d of %d climbers active, %u activations so far, %.4f ms per frame saved"),
+		NumSensingClimbers, NumClimbers, AClimbSystemCharacter::GetClimbSensingActivations(), SavedMilliseconds);
+	UE_LOG(LogClimb, Display, TEXT("  Telemetry  : %.3f us per recorded event, climb.Telemetry is %s"),
+		TelemetryMilliseconds * 1000.0 / NumClimbers, FClimbTelemetry::IsEnabled() ? TEXT("on") : TEXT("off"));
+	for (int32 Tier = 0; Tier < NumTiers; Tier++)
+		UE_LOG(LogClimb, Display, TEXT("  Quality %d  : %.4f ms per frame for all climbers%s"), Tier, TierMilliseconds[Tier],
+			Tier == PreviousTier ? TEXT(" (current)") : TEXT(""));
+
+	UE_LOG(LogClimb, Display, TEXT("  Snapshot   : %.3f us per save, %d round trip failures"), SnapshotMilliseconds * 1000.0 / NumClimbers, RoundTripFailures);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs ClimbBenchmarkCommand(
+	TEXT("climb.Benchmark"),
+	TEXT("Measures the cost of the climb probes with every probe mode. Usage: climb.Benchmark [Iterations]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunClimbBenchmark));
+
+/*
+ * Path query benchmark. Finds paths between random navigable points and counts the ones that take a climb nav link.
+ * UE4Editor ClimbSystem <Map> -game -nullrhi -ExecCmds="climb.NavBenchmark 200"
+ */
+static void RunClimbNavBenchmark(const TArray<FString>& Args, UWorld* World)
+{
+	const int32 Queries = Args.Num() > 0 ? FMath::Max(FCString::Atoi(*Args[0]), 1) : 200;
+
+	UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(World);
+	ANavigationData* NavData = NavSystem ? NavSystem->GetDefaultNavDataInstance() : nullptr;
+
+	if (!NavData)
+	{
+		UE_LOG(LogClimb, Warning, TEXT("climb.NavBenchmark: no navigation data in the world"));
+		return;
+	}
+
+	int32 NumLinks = 0;
+	for (TActorIterator<AClimbNavLinks> It(World); It; ++It)
+		NumLinks += It->GetTraversals().Num();
+
+	//Fixed seed, so runs with and without links ask for the same paths.
+	FRandomStream Random(1234);
+	int32 NumFound			= 0;
+	int32 NumClimbing		= 0;
+	double TotalMilliseconds	= 0.0;
+	double MaxMilliseconds		= 0.0;
+
+	for (int32 Query = 0; Query < Queries; Query++)
+	{
+		FNavLocation Start;
+		FNavLocation End;
+
+		if (!NavSystem->GetRandomPoint(Start, NavData) || !NavSystem->GetRandomPoint(End, NavData))
+			continue;
+
+		const FPathFindingQuery PathQuery(nullptr, *NavData, Start.Location, End.Location);
+
+		const uint64 StartCycles			= FPlatformTime::Cycles64();
+		const FPathFindingResult Result		= NavSystem->FindPathSync(PathQuery);
+		const double Milliseconds			= FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles);
+
+		TotalMilliseconds	+= Milliseconds;
+		MaxMilliseconds		= FMath::Max(MaxMilliseconds, Milliseconds);
+
+		if (!Result.IsSuccessful() || Result.IsPartial())
+			continue;
+
+		NumFound++;
+
+		const TArray<FNavPathPoint>& Points = Result.Path->GetPathPoints();
+		for (int32 Index = 0; Index + 1 < Points.Num(); Index++)
+		{
+			if (FNavMeshNodeFlags(Points[Index].Flags).IsNavLink() && AClimbNavLinks::FindTraversalInWorld(World, Points[Index].Location, Points[Index + 1].Location))
+			{
+				NumClimbing++;
+				break;
+			}
+		}
+	}
+
+	UE_LOG(LogClimb, Display, TEXT("climb.NavBenchmark: %d queries, %d climb links"), Queries, NumLinks);
+	UE_LOG(LogClimb, Display, TEXT("  Path       : %.4f ms avg, %.4f ms max"), TotalMilliseconds / Queries, MaxMilliseconds);
+	UE_LOG(LogClimb, Display, TEXT("  Found      : %d complete paths, %d of them climb"), NumFound, NumClimbing);
+}
+
+static FAutoConsoleCommandWithWorldAndArgs ClimbNavBenchmarkCommand(
+	TEXT("climb.NavBenchmark"),
+	TEXT("Measures path queries over the climb nav links. Usage: climb.NavBenchmark [Queries]"),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateStatic(&RunClimbNavBenchmark));
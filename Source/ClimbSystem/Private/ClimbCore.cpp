@@ -0,0 +1,79 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbCore.h"
+#include <cmath>
+
+namespace ClimbCore
+{
+	static constexpr float RadiansToDegrees = 57.2957795130823208768f;
+
+	FGrabTarget ComputeGrabTarget(const FGrabInput& Input)
+	{
+		FGrabTarget Target;
+
+		Target.Location.X = Input.WallNormal.X * Rules::HangWallOffset + Input.WallLocation.X;
+		Target.Location.Y = Input.WallNormal.Y * Rules::HangWallOffset + Input.WallLocation.Y;
+		Target.Location.Z = Input.LedgeHeight - Rules::HangHeightOffset;
+
+		//Rotation of the wall normal, turned around to face the wall.
+		const float HorizontalLength = std::sqrt(Input.WallNormal.X * Input.WallNormal.X + Input.WallNormal.Y * Input.WallNormal.Y);
+
+		Target.Rotation.Pitch	= std::atan2(Input.WallNormal.Z, HorizontalLength) * RadiansToDegrees;
+		Target.Rotation.Yaw		= std::atan2(Input.WallNormal.Y, Input.WallNormal.X) * RadiansToDegrees - 180.0f;
+		Target.Rotation.Roll	= 0.0f;
+
+		return Target;
+	}
+
+	bool IsPelvisInGrabRange(float PelvisHeight, float LedgeHeight)
+	{
+		const float RangeValue = PelvisHeight - LedgeHeight;
+		return RangeValue >= Rules::PelvisRangeMin && RangeValue <= Rules::PelvisRangeMax;
+	}
+
+	EJumpAction DecideJumpAction(const FJumpInput& Input)
+	{
+		if (!Input.bIsHanging)
+			return EJumpAction::Jump;
+
+		if (Input.bTurnedBack)
+			return Input.bIsJumping ? EJumpAction::None : EJumpAction::JumpBack;
+
+		if (Input.bCanJumpRight)
+		{
+			if (Input.MoveRightAxis > 0.0f)
+				return Input.bIsJumping ? EJumpAction::None : EJumpAction::JumpRight;
+
+			return EJumpAction::ClimbLedge;
+		}
+
+		if (Input.bCanJumpLeft)
+		{
+			if (Input.MoveRightAxis < 0.0f)
+				return Input.bIsJumping ? EJumpAction::None : EJumpAction::JumpLeft;
+
+			return EJumpAction::ClimbLedge;
+		}
+
+		if (Input.bCanJumpUp)
+			return (Input.MoveRightAxis == 0.0f && !Input.bIsJumping) ? EJumpAction::JumpUp : EJumpAction::None;
+
+		return EJumpAction::ClimbLedge;
+	}
+
+	FSideOptions EvaluateSide(bool bCanMove, bool bLedgeProbeHit, bool bCornerProbeHit)
+	{
+		FSideOptions Options;
+
+		if (bCanMove)
+			return Options;
+
+		Options.bCanJump = bLedgeProbeHit;
+		Options.bCanTurn = !Options.bCanJump && !bCornerProbeHit;
+
+		return Options;
+	}
+}
@@ -0,0 +1,32 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimbCore.h"
+
+/* Conversions between ClimbCore plain data and engine types*/
+namespace ClimbCore
+{
+	FORCEINLINE FVec3 ToCore(const FVector& Vector)
+	{
+		FVec3 Result;
+		Result.X = Vector.X;
+		Result.Y = Vector.Y;
+		Result.Z = Vector.Z;
+		return Result;
+	}
+
+	FORCEINLINE FVector ToEngine(const FVec3& Vector)
+	{
+		return FVector(Vector.X, Vector.Y, Vector.Z);
+	}
+
+	FORCEINLINE FRotator ToEngine(const FRot& Rotation)
+	{
+		return FRotator(Rotation.Pitch, Rotation.Yaw, Rotation.Roll);
+	}
+}
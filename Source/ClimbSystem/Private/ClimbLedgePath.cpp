@@ -0,0 +1,90 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbLedgePath.h"
+
+void FClimbLedgePath::Reset(const FVector& WallLocation, const FVector& WallNormal, float LedgeHeight)
+{
+	Points.Reset();
+
+	FClimbLedgePoint& Point = Points.AddDefaulted_GetRef();
+	Point.WallLocation		= WallLocation;
+	Point.WallNormal		= WallNormal;
+	Point.LedgeHeight		= LedgeHeight;
+
+	bRightEndReached	= false;
+	bLeftEndReached		= false;
+}
+
+void FClimbLedgePath::Invalidate()
+{
+	Points.Reset();
+}
+
+void FClimbLedgePath::Extend(bool bRight, const FVector& WallLocation, const FVector& WallNormal, float LedgeHeight)
+{
+	const FClimbLedgePoint& End = GetEnd(bRight);
+	const float Step			= FVector::Dist2D(End.WallLocation, WallLocation);
+
+	FClimbLedgePoint Point;
+	Point.WallLocation	= WallLocation;
+	Point.WallNormal	= WallNormal;
+	Point.LedgeHeight	= LedgeHeight;
+	Point.Distance		= bRight ? End.Distance + Step : End.Distance - Step;
+
+	if (bRight)
+		Points.Add(Point);
+	else
+		Points.Insert(Point, 0);
+}
+
+FClimbLedgePoint FClimbLedgePath::Sample(float Distance) const
+{
+	if (Distance <= GetMinDistance())
+		return Points[0];
+
+	if (Distance >= GetMaxDistance())
+		return Points.Last();
+
+	int32 Index = 1;
+	while (Points[Index].Distance < Distance)
+		Index++;
+
+	const FClimbLedgePoint& Previous	= Points[Index - 1];
+	const FClimbLedgePoint& Next		= Points[Index];
+	const float Alpha					= (Distance - Previous.Distance) / FMath::Max(Next.Distance - Previous.Distance, KINDA_SMALL_NUMBER);
+
+	FClimbLedgePoint Point;
+	Point.WallLocation	= FMath::Lerp(Previous.WallLocation, Next.WallLocation, Alpha);
+	Point.WallNormal	= FMath::Lerp(Previous.WallNormal, Next.WallNormal, Alpha).GetSafeNormal2D();
+	Point.LedgeHeight	= FMath::Lerp(Previous.LedgeHeight, Next.LedgeHeight, Alpha);
+	Point.Distance		= Distance;
+
+	return Point;
+}
+
+void FClimbLedgePath::Trim(float Distance, float KeepBehind)
+{
+	int32 NumBefore = 0;
+	while (NumBefore < Points.Num() - 1 && Points[NumBefore + 1].Distance < Distance - KeepBehind)
+		NumBefore++;
+
+	//Once points are dropped from a side, the end of the path there is no longer the end of the ledge.
+	if (NumBefore > 0)
+	{
+		Points.RemoveAt(0, NumBefore, false);
+		bLeftEndReached = false;
+	}
+
+	int32 NumAfter = 0;
+	while (NumAfter < Points.Num() - 1 && Points[Points.Num() - 2 - NumAfter].Distance > Distance + KeepBehind)
+		NumAfter++;
+
+	if (NumAfter > 0)
+	{
+		Points.RemoveAt(Points.Num() - NumAfter, NumAfter, false);
+		bRightEndReached = false;
+	}
+}
@@ -0,0 +1,263 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbLedgeScanner.h"
+
+#if WITH_EDITOR
+
+#include "ClimbSystem.h"
+#include "ClimbCoreBridge.h"
+#include "ClimbSettings.h"
+#include "Async/ParallelFor.h"
+#include "Components/BoxComponent.h"
+#include "Components/PrimitiveComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+
+const float FClimbLedgeScanner::ProbeReach = 500.0f;
+
+/* Up axis Z a primitive needs for its local top face to be its top*/
+static const float MinUprightZ = 0.99f;
+
+/* True if the simple collision of the primitive is a single box, so its local bounds are its shape*/
+static bool IsBoxShaped(const UPrimitiveComponent* Component)
+{
+	if (Component->IsA<UBoxComponent>())
+		return true;
+
+	const UBodySetup* BodySetup = const_cast<UPrimitiveComponent*>(Component)->GetBodySetup();
+	if (!BodySetup)
+		return false;
+
+	const FKAggregateGeom& Geom = BodySetup->AggGeom;
+	return Geom.BoxElems.Num() == 1 && Geom.SphereElems.Num() == 0 && Geom.SphylElems.Num() == 0 &&
+		   Geom.ConvexElems.Num() == 0 && Geom.TaperedCapsuleElems.Num() == 0;
+}
+
+FClimbLedgeScanner::FClimbLedgeScanner(UWorld* InWorld, const FClimbReachSettings& InReachSettings, float InSampleSpacing)
+	: World(InWorld)
+	, ReachSettings(InReachSettings)
+	, SampleSpacing(FMath::Max(InSampleSpacing, 1.0f))
+{
+}
+
+void FClimbLedgeScanner::GatherPrimitives()
+{
+	Primitives.Reset();
+
+	int32 NumNotBoxes	= 0;
+	int32 NumTilted		= 0;
+
+	for (TActorIterator<AActor> It(World); It; ++It)
+	{
+		TInlineComponentArray<UPrimitiveComponent*> Components;
+		It->GetComponents(Components);
+
+		for (UPrimitiveComponent* Component : Components)
+		{
+			if (Component->IsRegistered() && Component->IsQueryCollisionEnabled() &&
+				Component->GetCollisionResponseToChannel(ECC_GameTraceChannel1) == ECR_Block)
+			{
+				FClimbablePrimitive& Primitive = Primitives.AddDefaulted_GetRef();
+				Primitive.Component = Component;
+				Primitive.Bounds	= Component->Bounds.GetBox();
+				Primitive.LocalBox	= Component->CalcBounds(FTransform::Identity).GetBox();
+				Primitive.Transform = Component->GetComponentTransform();
+				Primitive.bIsBox	= IsBoxShaped(Component);
+
+				if (Primitive.Transform.GetUnitAxis(EAxis::Z).Z < MinUprightZ)
+					NumTilted++;
+
+				if (!Primitive.bIsBox)
+				{
+					NumNotBoxes++;
+					UE_LOG(LogClimb, Verbose, TEXT("Ledge scan: %s is not a box, its ledges are taken from the box around it"), *Component->GetPathName());
+				}
+			}
+		}
+	}
+
+	//Cylinders, ramps and detailed meshes have ledges the box around them doesn't have, and the other way around.
+	if (NumNotBoxes > 0)
+		UE_LOG(LogClimb, Warning, TEXT("Ledge scan: %d of %d LedgeTrace primitives are not boxes. Their ledges are taken from the box around them and may be wrong or missing"),
+			NumNotBoxes, Primitives.Num());
+
+	if (NumTilted > 0)
+		UE_LOG(LogClimb, Warning, TEXT("Ledge scan: %d of %d LedgeTrace primitives are tilted off the vertical and are skipped"), NumTilted, Primitives.Num());
+}
+
+void FClimbLedgeScanner::ScanLedges()
+{
+	TArray<TArray<FClimbLedgeSample>> PerPrimitiveSamples;
+	PerPrimitiveSamples.SetNum(Primitives.Num());
+
+	//Scene queries only read the physics scene, so every primitive can be scanned on its own worker.
+	ParallelFor(Primitives.Num(), [this, &PerPrimitiveSamples](int32 Index)
+	{
+		ScanPrimitive(Primitives[Index], PerPrimitiveSamples[Index]);
+	});
+
+	Samples.Reset();
+	for (TArray<FClimbLedgeSample>& PrimitiveSamples : PerPrimitiveSamples)
+		Samples.Append(MoveTemp(PrimitiveSamples));
+}
+
+int32 FClimbLedgeScanner::CountPrimitivesInBox(const FBox& Box) const
+{
+	int32 Count = 0;
+
+	for (const FClimbablePrimitive& Primitive : Primitives)
+	{
+		if (Primitive.Bounds.Intersect(Box))
+			Count++;
+	}
+
+	return Count;
+}
+
+FBox FClimbLedgeScanner::GetPrimitivesBounds() const
+{
+	FBox Bounds(ForceInit);
+
+	for (const FClimbablePrimitive& Primitive : Primitives)
+		Bounds += Primitive.Bounds;
+
+	return Bounds;
+}
+
+void FClimbLedgeScanner::ScanPrimitive(const FClimbablePrimitive& Primitive, TArray<FClimbLedgeSample>& OutSamples) const
+{
+	const FBox& Box				= Primitive.LocalBox;
+	const FTransform& Transform	= Primitive.Transform;
+
+	//Only a primitive standing upright has its local top face on top.
+	if (!Box.IsValid || Transform.GetUnitAxis(EAxis::Z).Z < MinUprightZ)
+		return;
+
+	const float TopZ = Box.Max.Z;
+
+	struct FEdge { FVector Start; FVector End; FVector Normal; };
+
+	const FEdge LocalEdges[4] =
+	{
+		{ FVector(Box.Max.X, Box.Min.Y, TopZ), FVector(Box.Max.X, Box.Max.Y, TopZ), FVector( 1.0f,  0.0f, 0.0f) },
+		{ FVector(Box.Min.X, Box.Min.Y, TopZ), FVector(Box.Min.X, Box.Max.Y, TopZ), FVector(-1.0f,  0.0f, 0.0f) },
+		{ FVector(Box.Min.X, Box.Max.Y, TopZ), FVector(Box.Max.X, Box.Max.Y, TopZ), FVector( 0.0f,  1.0f, 0.0f) },
+		{ FVector(Box.Min.X, Box.Min.Y, TopZ), FVector(Box.Max.X, Box.Min.Y, TopZ), FVector( 0.0f, -1.0f, 0.0f) },
+	};
+
+	FEdge Edges[4];
+
+	for (int32 Index = 0; Index < 4; Index++)
+	{
+		Edges[Index].Start	= Transform.TransformPosition(LocalEdges[Index].Start);
+		Edges[Index].End	= Transform.TransformPosition(LocalEdges[Index].End);
+		Edges[Index].Normal = Transform.TransformVectorNoScale(LocalEdges[Index].Normal).GetSafeNormal2D();
+	}
+
+	for (const FEdge& Edge : Edges)
+	{
+		const float EdgeLength	= FVector::Dist(Edge.Start, Edge.End);
+		const int32 NumSamples	= FMath::Max(1, FMath::FloorToInt(EdgeLength / SampleSpacing));
+
+		for (int32 SampleIndex = 0; SampleIndex < NumSamples; SampleIndex++)
+		{
+			const float Alpha			= (SampleIndex + 0.5f) / NumSamples;
+			const FVector EdgePoint		= FMath::Lerp(Edge.Start, Edge.End, Alpha);
+
+			FClimbLedgeSample Sample;
+			if (EvaluateEdgePoint(EdgePoint, Edge.Normal, Sample))
+				OutSamples.Add(Sample);
+		}
+	}
+}
+
+bool FClimbLedgeScanner::EvaluateEdgePoint(const FVector& EdgePoint, const FVector& OutwardNormal, FClimbLedgeSample& OutSample) const
+{
+	using namespace ClimbCore::Rules;
+	using ClimbCore::ToEngine;
+
+	FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(ClimbLedgeScan), false);
+	FHitResult HitResult;
+
+	//Real top of the ledge, just inside the edge.
+	const FVector TopStart	= EdgePoint - OutwardNormal * 5.0f + FVector(0.0f, 0.0f, 20.0f);
+	const FVector TopEnd	= TopStart - FVector(0.0f, 0.0f, 200.0f);
+
+	if (!World->LineTraceSingleByChannel(HitResult, TopStart, TopEnd, ECC_GameTraceChannel1, QueryParams) || HitResult.ImpactNormal.Z < 0.7f)
+		return false;
+
+	const float LedgeZ = HitResult.ImpactPoint.Z;
+
+	//Wall face right under the ledge.
+	const FVector WallStart = FVector(EdgePoint.X, EdgePoint.Y, LedgeZ - 20.0f) + OutwardNormal * 50.0f;
+	const FVector WallEnd	= WallStart - OutwardNormal * 100.0f;
+
+	if (!World->LineTraceSingleByChannel(HitResult, WallStart, WallEnd, ECC_GameTraceChannel1, QueryParams) || FMath::Abs(HitResult.ImpactNormal.Z) > 0.3f)
+		return false;
+
+	const FVector WallNormal	= HitResult.ImpactNormal.GetSafeNormal2D();
+	const FVector WallPoint		= HitResult.ImpactPoint;
+
+	OutSample.LedgeLocation		= FVector(WallPoint.X, WallPoint.Y, LedgeZ);
+	OutSample.WallNormal		= WallNormal;
+
+	//The probes give GrabLedge the centres of their shapes, not the surface points, so the hang spot is worked out the same way.
+	const float ProbeRadius		= FClimbProbeSettings::Get().GetProbeShapeRadius();
+
+	ClimbCore::FGrabInput GrabInput;
+	GrabInput.WallLocation		= ClimbCore::ToCore(WallPoint + WallNormal * ProbeRadius);
+	GrabInput.WallNormal		= ClimbCore::ToCore(WallNormal);
+	GrabInput.LedgeHeight		= LedgeZ + ProbeRadius;
+
+	OutSample.HangLocation		= ToEngine(ClimbCore::ComputeGrabTarget(GrabInput).Location);
+
+	//Floor in front of the wall, where a jump would start from.
+	const FVector FloorStart	= OutSample.LedgeLocation + WallNormal * (ReachSettings.CapsuleRadius + 30.0f);
+	const FVector FloorEnd		= FloorStart - FVector(0.0f, 0.0f, 10000.0f);
+
+	OutSample.FloorHeight = World->LineTraceSingleByChannel(HitResult, FloorStart, FloorEnd, ECC_Visibility, QueryParams) ?
+							HitResult.ImpactPoint.Z : -WORLD_MAX;
+
+	//The grab fires while the pelvis is between 50 units under the ledge and the ledge itself.
+	const float StandingZ		= OutSample.FloorHeight + ReachSettings.CapsuleHalfHeight;
+	const float JumpApex		= FMath::Square(ReachSettings.JumpZVelocity) / (2.0f * FMath::Max(FMath::Abs(ReachSettings.GravityZ), KINDA_SMALL_NUMBER));
+	OutSample.bInJumpReach		= LedgeZ >= StandingZ - PelvisRangeMax && LedgeZ <= StandingZ + JumpApex - PelvisRangeMin;
+
+	//ForwardTracer and HeightTracer from a character against the wall at grab height.
+	const FVector GrabActorLocation = FVector(WallPoint.X, WallPoint.Y, LedgeZ + (PelvisRangeMin + PelvisRangeMax) * 0.5f) + WallNormal * (ReachSettings.CapsuleRadius + 5.0f);
+	const FVector Forward			= -WallNormal;
+	const FCollisionShape ProbeSphere = FCollisionShape::MakeSphere(ProbeSphereRadius);
+
+	OutSample.bForwardProbeHit = World->SweepTestByChannel(GrabActorLocation, GrabActorLocation + Forward * ForwardProbeLength,
+								 FQuat::Identity, ECC_GameTraceChannel1, ProbeSphere, QueryParams);
+
+	const FVector HeightStart	= GrabActorLocation + FVector(0.0f, 0.0f, HeightProbeStart) + Forward * HeightProbeForward;
+	const FVector HeightEnd		= FVector(HeightStart.X, HeightStart.Y, HeightStart.Z - HeightProbeStart);
+
+	OutSample.bHeightProbeHit	= World->SweepSingleByChannel(HitResult, HeightStart, HeightEnd, FQuat::Identity, ECC_GameTraceChannel1, ProbeSphere, QueryParams) &&
+								  FMath::Abs(HitResult.Location.Z - LedgeZ) <= ProbeSphereRadius - PelvisRangeMin;
+
+	OutSample.bGrabbable		= OutSample.bForwardProbeHit && OutSample.bHeightProbeHit && OutSample.bInJumpReach;
+
+	//Hanging probes, placed where GrabLedge leaves the capsule.
+	const FTransform HangTransform(Forward.Rotation(), OutSample.HangLocation);
+	const FCollisionShape SideCapsule	= FCollisionShape::MakeCapsule(SideCapsuleRadius, SideCapsuleHalfHeight);
+	const FCollisionShape LedgeCapsule	= FCollisionShape::MakeCapsule(LedgeCapsuleRadius, LedgeCapsuleHalfHeight);
+	const FCollisionShape UpCapsule		= FCollisionShape::MakeCapsule(UpCapsuleRadius, UpCapsuleHalfHeight);
+
+	OutSample.bCanMoveRight		= World->OverlapBlockingTestByChannel(HangTransform.TransformPosition(ToEngine(RightArrowOffset)), FQuat::Identity, ECC_GameTraceChannel1, SideCapsule, QueryParams);
+	OutSample.bCanMoveLeft		= World->OverlapBlockingTestByChannel(HangTransform.TransformPosition(ToEngine(LeftArrowOffset)), FQuat::Identity, ECC_GameTraceChannel1, SideCapsule, QueryParams);
+	OutSample.bCanJumpRight		= !OutSample.bCanMoveRight && World->OverlapBlockingTestByChannel(HangTransform.TransformPosition(ToEngine(RightLedgeOffset)), FQuat::Identity, ECC_GameTraceChannel1, LedgeCapsule, QueryParams);
+	OutSample.bCanJumpLeft		= !OutSample.bCanMoveLeft && World->OverlapBlockingTestByChannel(HangTransform.TransformPosition(ToEngine(LeftLedgeOffset)), FQuat::Identity, ECC_GameTraceChannel1, LedgeCapsule, QueryParams);
+	OutSample.bCanJumpUp		= World->OverlapBlockingTestByChannel(HangTransform.TransformPosition(ToEngine(UpArrowOffset)), FQuat::Identity, ECC_GameTraceChannel1, UpCapsule, QueryParams);
+
+	OutSample.NearbyPrimitives	= CountPrimitivesInBox(FBox::BuildAABB(OutSample.HangLocation, FVector(ProbeReach)));
+
+	return true;
+}
+
+#endif
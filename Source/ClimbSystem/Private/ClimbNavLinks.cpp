@@ -0,0 +1,322 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbNavLinks.h"
+#include "ClimbSystem.h"
+#include "ClimbSystemCharacter.h"
+#include "AI/NavigationSystemBase.h"
+#include "AI/NavigationSystemHelpers.h"
+#include "AI/Navigation/NavigationRelevantData.h"
+#include "Components/CapsuleComponent.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+#if WITH_EDITOR
+#include "ClimbLedgeScanner.h"
+#endif
+
+//Cell size of the grids used to find landing ledges and to look links up by where they start.
+static const float ClimbNavGridSize = 200.0f;
+
+AClimbNavLinks::AClimbNavLinks()
+{
+	PrimaryActorTick.bCanEverTick = false;
+
+	RootComponent = CreateDefaultSubobject<USceneComponent>(TEXT("Root"));
+	ClimberClass = AClimbSystemCharacter::StaticClass();
+}
+
+void AClimbNavLinks::BeginPlay()
+{
+	Super::BeginPlay();
+
+#if WITH_EDITOR
+	//The scanner is editor only, cooked games run the links saved with the level.
+	if (Traversals.Num() == 0 && bGenerateOnBeginPlay)
+		Generate();
+#else
+	if (Traversals.Num() == 0)
+		UE_LOG(LogClimb, Warning, TEXT("ClimbNavLinks: %s has no links, generate them in the editor and save the level"), *GetName());
+#endif
+}
+
+void AClimbNavLinks::PostLoad()
+{
+	Super::PostLoad();
+
+	//Only the traversals are saved, the links are made again before the actor registers with the navigation system.
+	RebuildNavLinks(false);
+}
+
+#if WITH_EDITOR
+
+void AClimbNavLinks::Generate()
+{
+	LLM_SCOPE_CLIMB();
+
+	UWorld* World = GetWorld();
+	if (!World)
+		return;
+
+	const AClimbSystemCharacter* DefaultCharacter = (ClimberClass ? *ClimberClass : AClimbSystemCharacter::StaticClass())->GetDefaultObject<AClimbSystemCharacter>();
+
+	FClimbReachSettings ReachSettings;
+	ReachSettings.CapsuleRadius		= DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleRadius();
+	ReachSettings.CapsuleHalfHeight = DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+	ReachSettings.JumpZVelocity		= DefaultCharacter->GetCharacterMovement()->JumpZVelocity;
+	ReachSettings.GravityZ			= World->GetGravityZ();
+
+	const double StartTime = FPlatformTime::Seconds();
+
+	FClimbLedgeScanner Scanner(World, ReachSettings, SampleSpacing);
+	Scanner.GatherPrimitives();
+	Scanner.ScanLedges();
+
+	Traversals.Reset();
+	AddTraversals(Scanner, ReachSettings);
+	RebuildNavLinks(true);
+
+	UE_LOG(LogClimb, Log, TEXT("ClimbNavLinks: %d links from %d ledge samples in %.1f ms"), Traversals.Num(), Scanner.GetSamples().Num(),
+		(FPlatformTime::Seconds() - StartTime) * 1000.0);
+}
+
+void AClimbNavLinks::AddTraversals(const FClimbLedgeScanner& Scanner, const FClimbReachSettings& ReachSettings)
+{
+	namespace Rules = ClimbCore::Rules;
+
+	const TArray<FClimbLedgeSample>& Samples = Scanner.GetSamples();
+
+	TMultiMap<FIntVector, int32> SampleGrid;
+	for (int32 Index = 0; Index < Samples.Num(); Index++)
+		SampleGrid.Add(GetGridCell(Samples[Index].LedgeLocation), Index);
+
+	//Where the link meets the navmesh: in front of the wall on the floor, and on top of the ledge.
+	auto GetFloorPoint = [&ReachSettings](const FClimbLedgeSample& Sample)
+	{
+		return FVector(Sample.LedgeLocation.X, Sample.LedgeLocation.Y, Sample.FloorHeight) + Sample.WallNormal * (ReachSettings.CapsuleRadius + 30.0f);
+	};
+
+	auto GetTopPoint = [&ReachSettings](const FClimbLedgeSample& Sample)
+	{
+		return Sample.LedgeLocation - Sample.WallNormal * (ReachSettings.CapsuleRadius + Rules::LedgePathTopInset);
+	};
+
+	//Best sample of the same wall that a side jump or jump up from From lands on. Score is -1 where it can't land.
+	auto FindLanding = [&Samples, &SampleGrid, this](const FClimbLedgeSample& From, TFunctionRef<float(const FVector&)> Score) -> const FClimbLedgeSample*
+	{
+		const FIntVector Cell		= GetGridCell(From.LedgeLocation);
+		const FClimbLedgeSample* Best = nullptr;
+		float BestScore				= MAX_flt;
+
+		for (int32 X = -2; X <= 2; X++)
+		for (int32 Y = -2; Y <= 2; Y++)
+		for (int32 Z = -2; Z <= 2; Z++)
+		{
+			for (auto It = SampleGrid.CreateConstKeyIterator(Cell + FIntVector(X, Y, Z)); It; ++It)
+			{
+				const FClimbLedgeSample& To = Samples[It.Value()];
+
+				if (&To == &From || !To.bForwardProbeHit || !To.bHeightProbeHit || (To.WallNormal | From.WallNormal) < 0.9f)
+					continue;
+
+				const float ToScore = Score(To.LedgeLocation - From.LedgeLocation);
+				if (ToScore >= 0.0f && ToScore < BestScore)
+				{
+					Best		= &To;
+					BestScore	= ToScore;
+				}
+			}
+		}
+
+		return Best;
+	};
+
+	auto AddTraversal = [this](const FClimbTraversal& Traversal)
+	{
+		const FIntVector Cell	= GetGridCell(Traversal.Start);
+		const int32 Range		= FMath::CeilToInt(LinkSpacing / ClimbNavGridSize);
+
+		for (int32 X = -Range; X <= Range; X++)
+		for (int32 Y = -Range; Y <= Range; Y++)
+		for (int32 Z = -Range; Z <= Range; Z++)
+		{
+			for (auto It = TraversalGrid.CreateConstKeyIterator(Cell + FIntVector(X, Y, Z)); It; ++It)
+			{
+				const FClimbTraversal& Other = Traversals[It.Value()];
+
+				if (Other.Type == Traversal.Type && FVector::DistSquared(Other.Start, Traversal.Start) < FMath::Square(LinkSpacing))
+					return;
+			}
+		}
+
+		TraversalGrid.Add(Cell, Traversals.Add(Traversal));
+	};
+
+	const float SideJumpReach	= Rules::RightLedgeOffset.Y;
+	const float JumpUpReach		= Rules::UpArrowOffset.Z + Rules::UpCapsuleHalfHeight;
+
+	for (const FClimbLedgeSample& Sample : Samples)
+	{
+		const bool bHasFloor = Sample.FloorHeight > -WORLD_MAX;
+
+		FClimbTraversal Traversal;
+		Traversal.WallLocation	= Sample.LedgeLocation;
+		Traversal.WallNormal	= Sample.WallNormal;
+		Traversal.LedgeLocation = Sample.LedgeLocation;
+
+		//Anything higher than a step is worth a link down.
+		if (bHasFloor && Sample.LedgeLocation.Z - Sample.FloorHeight > Rules::LedgePathMaxStepHeight)
+		{
+			Traversal.Type	= EClimbTraversal::DropDown;
+			Traversal.Start = GetTopPoint(Sample);
+			Traversal.End	= GetFloorPoint(Sample);
+			AddTraversal(Traversal);
+		}
+
+		if (!Sample.bGrabbable || !bHasFloor)
+			continue;
+
+		Traversal.Start = GetFloorPoint(Sample);
+
+		Traversal.Type	= EClimbTraversal::GrabAndClimb;
+		Traversal.End	= GetTopPoint(Sample);
+		AddTraversal(Traversal);
+
+		const FVector Forward	= -Sample.WallNormal;
+		const FVector Right		= FVector::UpVector ^ Forward;
+
+		for (const bool bRight : { true, false })
+		{
+			if (!(bRight ? Sample.bCanJumpRight : Sample.bCanJumpLeft))
+				continue;
+
+			const FClimbLedgeSample* Landing = FindLanding(Sample, [&](const FVector& Offset)
+			{
+				const float Side = (Offset | Right) * (bRight ? 1.0f : -1.0f);
+				const bool bInReach = Side > Rules::LedgeCapsuleRadius && Side < SideJumpReach + Rules::LedgeCapsuleRadius &&
+									  FMath::Abs(Offset.Z) < Rules::LedgeCapsuleHalfHeight && FMath::Abs(Offset | Forward) < Rules::LedgePathWallReach;
+
+				return bInReach ? FMath::Abs(Side - SideJumpReach) : -1.0f;
+			});
+
+			if (Landing)
+			{
+				Traversal.Type					= EClimbTraversal::SideJump;
+				Traversal.End					= GetTopPoint(*Landing);
+				Traversal.TargetWallLocation	= Landing->LedgeLocation;
+				Traversal.TargetLedgeLocation	= Landing->LedgeLocation;
+				Traversal.bRight				= bRight;
+				AddTraversal(Traversal);
+			}
+		}
+
+		if (Sample.bCanJumpUp)
+		{
+			const FClimbLedgeSample* Landing = FindLanding(Sample, [&](const FVector& Offset)
+			{
+				const bool bInReach = Offset.Z > -Rules::PelvisRangeMin && Offset.Z < JumpUpReach &&
+									  FMath::Abs(Offset | Right) < SampleSpacing && FMath::Abs(Offset | Forward) < Rules::LedgePathWallReach;
+
+				return bInReach ? Offset.Z : -1.0f;
+			});
+
+			if (Landing)
+			{
+				Traversal.Type					= EClimbTraversal::JumpUp;
+				Traversal.End					= GetTopPoint(*Landing);
+				Traversal.TargetWallLocation	= Landing->LedgeLocation;
+				Traversal.TargetLedgeLocation	= Landing->LedgeLocation;
+				Traversal.bRight				= false;
+				AddTraversal(Traversal);
+			}
+		}
+	}
+}
+
+#endif
+
+void AClimbNavLinks::RebuildNavLinks(bool bUpdateNavigation)
+{
+	LLM_SCOPE_CLIMB();
+
+	NavLinks.Reset(Traversals.Num());
+	TraversalGrid.Reset();
+	NavLinksBounds = FBox(ForceInit);
+
+	const FTransform& ActorTransform = GetActorTransform();
+
+	for (int32 Index = 0; Index < Traversals.Num(); Index++)
+	{
+		const FClimbTraversal& Traversal = Traversals[Index];
+
+		NavLinks.Add(FNavigationLink(ActorTransform.InverseTransformPosition(Traversal.Start), ActorTransform.InverseTransformPosition(Traversal.End), ENavLinkDirection::LeftToRight));
+		TraversalGrid.Add(GetGridCell(Traversal.Start), Index);
+
+		NavLinksBounds += Traversal.Start;
+		NavLinksBounds += Traversal.End;
+	}
+
+	if (bUpdateNavigation)
+		FNavigationSystem::UpdateActorData(*this);
+}
+
+const FClimbTraversal* AClimbNavLinks::FindTraversal(const FVector& Start, const FVector& End, float Tolerance) const
+{
+	const FIntVector Cell		= GetGridCell(Start);
+	const FClimbTraversal* Best = nullptr;
+	float BestDistance			= 2.0f * Tolerance;
+
+	for (int32 X = -1; X <= 1; X++)
+	for (int32 Y = -1; Y <= 1; Y++)
+	for (int32 Z = -1; Z <= 1; Z++)
+	{
+		for (auto It = TraversalGrid.CreateConstKeyIterator(Cell + FIntVector(X, Y, Z)); It; ++It)
+		{
+			const FClimbTraversal& Traversal	= Traversals[It.Value()];
+			const float StartDistance			= FVector::Dist(Traversal.Start, Start);
+			const float EndDistance				= FVector::Dist(Traversal.End, End);
+
+			if (StartDistance <= Tolerance && EndDistance <= Tolerance && StartDistance + EndDistance < BestDistance)
+			{
+				Best			= &Traversal;
+				BestDistance	= StartDistance + EndDistance;
+			}
+		}
+	}
+
+	return Best;
+}
+
+const FClimbTraversal* AClimbNavLinks::FindTraversalInWorld(UWorld* World, const FVector& Start, const FVector& End)
+{
+	for (TActorIterator<AClimbNavLinks> It(World); It; ++It)
+	{
+		if (const FClimbTraversal* Traversal = It->FindTraversal(Start, End))
+			return Traversal;
+	}
+
+	return nullptr;
+}
+
+void AClimbNavLinks::GetNavigationData(FNavigationRelevantData& Data) const
+{
+	NavigationHelper::ProcessNavLinkAndAppend(&Data.Modifiers, this, NavLinks);
+}
+
+FBox AClimbNavLinks::GetNavigationBounds() const
+{
+	return NavLinksBounds;
+}
+
+bool AClimbNavLinks::IsNavigationRelevant() const
+{
+	return NavLinks.Num() > 0;
+}
+
+FIntVector AClimbNavLinks::GetGridCell(const FVector& Location) const
+{
+	return FIntVector(FMath::FloorToInt(Location.X / ClimbNavGridSize), FMath::FloorToInt(Location.Y / ClimbNavGridSize), FMath::FloorToInt(Location.Z / ClimbNavGridSize));
+}
@@ -0,0 +1,157 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbSettings.h"
+#include "ClimbCore.h"
+#include "ClimbSystemCharacter.h"
+#include "HAL/IConsoleManager.h"
+
+namespace Rules = ClimbCore::Rules;
+
+static const int32 AllClimbProbes = (1 << (int32)EClimbProbe::Count) - 1;
+
+#pragma region Console Variables
+
+static TAutoConsoleVariable<float> CVarClimbProbeSphereRadius(TEXT("climb.ProbeSphereRadius"),				Rules::ProbeSphereRadius,		TEXT("Radius of the forward, height and corner sphere probes."),	ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbForwardProbeLength(TEXT("climb.ForwardProbeLength"),				Rules::ForwardProbeLength,		TEXT("Reach of the forward wall probe."),							ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbHeightProbeStart(TEXT("climb.HeightProbeStart"),					Rules::HeightProbeStart,		TEXT("Height the ledge probe starts from, above the capsule."),		ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbCornerProbeLength(TEXT("climb.CornerProbeLength"),				Rules::CornerProbeLength,		TEXT("Reach of the corner probes."),								ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbSideCapsuleRadius(TEXT("climb.SideCapsuleRadius"),				Rules::SideCapsuleRadius,		TEXT("Radius of the shimmy probes."),								ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbSideCapsuleHalfHeight(TEXT("climb.SideCapsuleHalfHeight"),		Rules::SideCapsuleHalfHeight,	TEXT("Half height of the shimmy probes."),							ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbLedgeCapsuleRadius(TEXT("climb.LedgeCapsuleRadius"),				Rules::LedgeCapsuleRadius,		TEXT("Radius of the side jump probes."),							ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbLedgeCapsuleHalfHeight(TEXT("climb.LedgeCapsuleHalfHeight"),		Rules::LedgeCapsuleHalfHeight,	TEXT("Half height of the side jump probes."),						ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbUpCapsuleRadius(TEXT("climb.UpCapsuleRadius"),					Rules::UpCapsuleRadius,			TEXT("Radius of the jump up probe."),								ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbUpCapsuleHalfHeight(TEXT("climb.UpCapsuleHalfHeight"),			Rules::UpCapsuleHalfHeight,		TEXT("Half height of the jump up probe."),							ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbGrabSnapTime(TEXT("climb.GrabSnapTime"),							Rules::GrabSnapTime,			TEXT("Seconds GrabLedge takes to snap the capsule onto the ledge."),ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbMoveSidesSpeed(TEXT("climb.MoveSidesSpeed"),						Rules::MoveSidesSpeed,			TEXT("Interpolation speed of the shimmy while hanging."),			ECVF_Scalability);
+static TAutoConsoleVariable<float> CVarClimbInputBufferWindow(TEXT("climb.InputBufferWindow"),				Rules::InputBufferWindow,		TEXT("Seconds a climb action pressed too early waits to run. 0 drops it."),ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarClimbProbeInterval(TEXT("climb.ProbeInterval"),						1,								TEXT("Frames between two refreshes of each climb probe. The ledge height probe always runs."),	ECVF_Scalability);
+static TAutoConsoleVariable<int32> CVarClimbProbeSimpleShapes(TEXT("climb.ProbeSimpleShapes"),				0,								TEXT("1 turns the forward, height and corner sphere sweeps into rays."),						ECVF_Scalability);
+static TAutoConsoleVariable<int32> CVarClimbAsyncProbes(TEXT("climb.AsyncProbes"),							0,								TEXT("1 queues the PerProbe queries as async sweeps, answered one frame late. The ledge height probe always runs."),				ECVF_Scalability);
+static TAutoConsoleVariable<int32> CVarClimbActiveProbes(TEXT("climb.ActiveProbes"),							AllClimbProbes,					TEXT("One bit per climb probe, in EClimbProbe order. Moves backed by a cleared bit are off."),	ECVF_Scalability);
+
+/* What each climb.ProbeQuality tier sets. Every tier keeps the whole probe set, since each probe backs a move*/
+struct FClimbQualityTier
+{
+	int32 ProbeInterval;
+	int32 SimpleShapes;
+	int32 AsyncProbes;
+	int32 ActiveProbes;
+};
+
+static const FClimbQualityTier ClimbQualityTiers[] =
+{
+	{ 3, 1, 1, AllClimbProbes },	//Low
+	{ 2, 1, 0, AllClimbProbes },	//Medium
+	{ 1, 0, 1, AllClimbProbes },	//High
+	{ 1, 0, 0, AllClimbProbes },	//Epic
+};
+
+static void OnClimbProbeQualityChanged(IConsoleVariable* Variable);
+
+static TAutoConsoleVariable<int32> CVarClimbProbeQuality(
+	TEXT("climb.ProbeQuality"),
+	(int32)ARRAY_COUNT(ClimbQualityTiers) - 1,
+	TEXT("Climb probe quality tier, set from the EffectsQuality scalability group and device profiles.\n")
+	TEXT(" 0: every 3 frames, rays, async\n")
+	TEXT(" 1: every 2 frames, rays\n")
+	TEXT(" 2: every frame, full shapes, async\n")
+	TEXT(" 3: every frame, full shapes, answered the same frame (default)"),
+	ECVF_Scalability);
+
+static void OnClimbProbeQualityChanged(IConsoleVariable* Variable)
+{
+	const FClimbQualityTier& Tier = ClimbQualityTiers[FMath::Clamp(Variable->GetInt(), 0, (int32)ARRAY_COUNT(ClimbQualityTiers) - 1)];
+
+	//The tier variables take the priority of whoever set the quality, so scalability never beats a device profile.
+	const EConsoleVariableFlags SetBy = (EConsoleVariableFlags)(Variable->GetFlags() & ECVF_SetByMask);
+
+	CVarClimbProbeInterval->Set(Tier.ProbeInterval, SetBy);
+	CVarClimbProbeSimpleShapes->Set(Tier.SimpleShapes, SetBy);
+	CVarClimbAsyncProbes->Set(Tier.AsyncProbes, SetBy);
+	CVarClimbActiveProbes->Set(Tier.ActiveProbes, SetBy);
+}
+
+static struct FClimbProbeQualityCallback
+{
+	FClimbProbeQualityCallback()
+	{
+		CVarClimbProbeQuality->SetOnChangedCallback(FConsoleVariableDelegate::CreateStatic(&OnClimbProbeQualityChanged));
+	}
+} ClimbProbeQualityCallback;
+
+#pragma endregion
+
+static FClimbProbeSettings ClimbProbeSettings =
+{
+	Rules::ProbeSphereRadius,
+	Rules::ForwardProbeLength,
+	Rules::HeightProbeStart,
+	Rules::CornerProbeLength,
+	Rules::SideCapsuleRadius,
+	Rules::SideCapsuleHalfHeight,
+	Rules::LedgeCapsuleRadius,
+	Rules::LedgeCapsuleHalfHeight,
+	Rules::UpCapsuleRadius,
+	Rules::UpCapsuleHalfHeight,
+	Rules::GrabSnapTime,
+	Rules::MoveSidesSpeed,
+	Rules::InputBufferWindow,
+	1,
+	false,
+	false,
+	(uint32)AllClimbProbes
+};
+
+const FClimbProbeSettings& FClimbProbeSettings::Get()
+{
+	return ClimbProbeSettings;
+}
+
+void FClimbProbeSettings::Refresh()
+{
+	ClimbProbeSettings.ProbeSphereRadius		= CVarClimbProbeSphereRadius.GetValueOnGameThread();
+	ClimbProbeSettings.ForwardProbeLength		= CVarClimbForwardProbeLength.GetValueOnGameThread();
+	ClimbProbeSettings.HeightProbeStart			= CVarClimbHeightProbeStart.GetValueOnGameThread();
+	ClimbProbeSettings.CornerProbeLength		= CVarClimbCornerProbeLength.GetValueOnGameThread();
+	ClimbProbeSettings.SideCapsuleRadius		= CVarClimbSideCapsuleRadius.GetValueOnGameThread();
+	ClimbProbeSettings.SideCapsuleHalfHeight	= CVarClimbSideCapsuleHalfHeight.GetValueOnGameThread();
+	ClimbProbeSettings.LedgeCapsuleRadius		= CVarClimbLedgeCapsuleRadius.GetValueOnGameThread();
+	ClimbProbeSettings.LedgeCapsuleHalfHeight	= CVarClimbLedgeCapsuleHalfHeight.GetValueOnGameThread();
+	ClimbProbeSettings.UpCapsuleRadius			= CVarClimbUpCapsuleRadius.GetValueOnGameThread();
+	ClimbProbeSettings.UpCapsuleHalfHeight		= CVarClimbUpCapsuleHalfHeight.GetValueOnGameThread();
+	ClimbProbeSettings.GrabSnapTime				= CVarClimbGrabSnapTime.GetValueOnGameThread();
+	ClimbProbeSettings.MoveSidesSpeed			= CVarClimbMoveSidesSpeed.GetValueOnGameThread();
+	ClimbProbeSettings.InputBufferWindow		= FMath::Max(CVarClimbInputBufferWindow.GetValueOnGameThread(), 0.0f);
+
+	ClimbProbeSettings.ProbeInterval			= FMath::Max(CVarClimbProbeInterval.GetValueOnGameThread(), 1);
+	ClimbProbeSettings.bSimpleShapes			= CVarClimbProbeSimpleShapes.GetValueOnGameThread() != 0;
+	ClimbProbeSettings.bAsyncProbes				= CVarClimbAsyncProbes.GetValueOnGameThread() != 0;
+	ClimbProbeSettings.ActiveProbes				= (uint32)CVarClimbActiveProbes.GetValueOnGameThread();
+}
+
+static FAutoConsoleVariableSink ClimbProbeSettingsSink(FConsoleCommandDelegate::CreateStatic(&FClimbProbeSettings::Refresh));
+
+int32 FClimbProbeSettings::GetNumQualityTiers()
+{
+	return (int32)ARRAY_COUNT(ClimbQualityTiers);
+}
+
+void FClimbProbeSettings::SetQualityTier(int32 Tier, EConsoleVariableFlags SetBy)
+{
+	CVarClimbProbeQuality->Set(Tier, SetBy);
+	Refresh();
+}
+
+EConsoleVariableFlags FClimbProbeSettings::GetQualityTierSetBy()
+{
+	return (EConsoleVariableFlags)(CVarClimbProbeQuality->GetFlags() & ECVF_SetByMask);
+}
+
+int32 FClimbProbeSettings::GetQualityTier()
+{
+	return CVarClimbProbeQuality.GetValueOnGameThread();
+}
@@ -0,0 +1,122 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbSoakBotController.h"
+
+static const float LongHangChance = 0.25f;
+
+AClimbSoakBotController::AClimbSoakBotController()
+{
+	PrimaryActorTick.bCanEverTick = true;
+}
+
+void AClimbSoakBotController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+	Climber = Cast<AClimbSystemCharacter>(InPawn);
+}
+
+void AClimbSoakBotController::OnUnPossess()
+{
+	Super::OnUnPossess();
+	Climber = nullptr;
+}
+
+void AClimbSoakBotController::SetRespawn(const FClimbSnapshot& Snapshot, float InKillZ)
+{
+	RespawnSnapshot = Snapshot;
+	KillZ			= InKillZ;
+	bHasRespawn		= true;
+}
+
+void AClimbSoakBotController::Respawn()
+{
+	if (Climber && bHasRespawn)
+	{
+		Climber->RestoreClimbSnapshot(RespawnSnapshot);
+		NumRespawns++;
+	}
+}
+
+void AClimbSoakBotController::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (!Climber)
+		return;
+
+	const float Now = GetWorld()->GetTimeSeconds();
+
+	//Falling off the course, and every now and then anyway, so bots don't get stuck away from the walls.
+	if (Climber->GetActorLocation().Z < KillZ || Now >= NextRespawnTime)
+	{
+		if (NextRespawnTime > 0.0f)
+			Respawn();
+
+		NextRespawnTime = Now + Random.FRandRange(30.0f, 120.0f);
+	}
+
+	//Some grabs are held still past the soak's grab snap limit, so a snap that never lands can't hide behind the next action.
+	const bool bHanging = Climber->IsHanging();
+
+	if (bHanging && !bWasHanging && LongHangSeconds > 0.0f && Random.FRand() < LongHangChance)
+	{
+		LongHangEndTime		= Now + LongHangSeconds;
+		NextDecisionTime	= LongHangEndTime;
+		MoveRightInput		= 0.0f;
+	}
+
+	if (LongHangEndTime >= 0.0f && (!bHanging || Now >= LongHangEndTime))
+	{
+		if (bHanging)
+			NumLongHangs++;
+
+		LongHangEndTime = -1.0f;
+	}
+
+	bWasHanging = bHanging;
+
+	if (Now >= NextDecisionTime)
+	{
+		Decide();
+		NextDecisionTime = Now + Random.FRandRange(0.2f, 1.5f);
+	}
+
+	if (!Climber->IsHanging())
+		Climber->AddMovementInput(WalkDirection, 1.0f);
+
+	Climber->SetClimbMoveRightInput(Climber->IsHanging() ? MoveRightInput : 0.0f);
+}
+
+void AClimbSoakBotController::Decide()
+{
+	if (Climber->IsHanging())
+	{
+		MoveRightInput = (float)Random.RandRange(-1, 1);
+
+		const float Roll = Random.FRand();
+
+		if (Roll < 0.25f)
+			Climber->RequestClimbAction(EClimbAction::Jump);
+		else if (Roll < 0.35f)
+			Climber->RequestClimbAction(EClimbAction::RightCorner);
+		else if (Roll < 0.45f)
+			Climber->RequestClimbAction(EClimbAction::LeftCorner);
+		else if (Roll < 0.50f)
+			Climber->RequestClimbAction(EClimbAction::ExitClimb);
+		else if (Roll < 0.55f)
+			Climber->RequestClimbAction(EClimbAction::Forward);
+	}
+
+	else
+	{
+		//Mostly towards the wall it spawned in front of, so most of the time goes into climbing.
+		const float Yaw = RespawnSnapshot.Rotation.Rotator().Yaw + Random.FRandRange(-60.0f, 60.0f);
+		WalkDirection	= FRotator(0.0f, Yaw, 0.0f).Vector();
+
+		if (Random.FRand() < 0.5f)
+			Climber->RequestClimbAction(EClimbAction::Jump);
+	}
+}
@@ -0,0 +1,113 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbSoakCourse.h"
+#include "ClimbSystem.h"
+#include "Components/BoxComponent.h"
+#include "Engine/CollisionProfile.h"
+
+AClimbSoakCourse::AClimbSoakCourse()
+{
+	//The floor blocks the climbers but not the climb probes, so it is never taken for a ledge.
+	Floor = CreateDefaultSubobject<UBoxComponent>(TEXT("Floor"));
+	Floor->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	Floor->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Ignore);
+	RootComponent = Floor;
+}
+
+void AClimbSoakCourse::OnConstruction(const FTransform& Transform)
+{
+	Super::OnConstruction(Transform);
+	Floor->SetBoxExtent(FVector(HalfSize + 2000.0f, HalfSize + 2000.0f, 50.0f));
+}
+
+void AClimbSoakCourse::Build()
+{
+	LLM_SCOPE_CLIMB();
+
+	for (UBoxComponent* Box : Boxes)
+		Box->DestroyComponent();
+
+	Boxes.Reset();
+	SpawnPoints.Reset();
+
+	Floor->SetBoxExtent(FVector(HalfSize + 2000.0f, HalfSize + 2000.0f, 50.0f));
+
+	FRandomStream Random(Seed);
+	const FVector FloorTop = GetActorLocation() + FVector(0.0f, 0.0f, 50.0f);
+
+	int32 NumAdded = 0;
+	while (NumAdded < NumBoxes)
+	{
+		const FVector Location	= FloorTop + FVector(Random.FRandRange(-HalfSize, HalfSize), Random.FRandRange(-HalfSize, HalfSize), 0.0f);
+		const FRotator Rotation(0.0f, Random.FRandRange(0.0f, 360.0f), 0.0f);
+
+		NumAdded += AddStructure(Random, FTransform(Rotation, Location));
+	}
+}
+
+void AClimbSoakCourse::AddBox(const FTransform& Frame, const FVector& Base, const FVector& Extent)
+{
+	UBoxComponent* Box = NewObject<UBoxComponent>(this);
+	Box->SetupAttachment(RootComponent);
+	Box->SetBoxExtent(Extent);
+	Box->SetWorldLocationAndRotation(Frame.TransformPosition(Base + FVector(0.0f, 0.0f, Extent.Z)), Frame.GetRotation());
+	Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+	Box->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Block);
+	Box->RegisterComponent();
+
+	Boxes.Add(Box);
+}
+
+int32 AClimbSoakCourse::AddStructure(FRandomStream& Random, const FTransform& Frame)
+{
+	//Structure space: the climbable face looks down -X, the ledge runs along Y.
+	const float Length		= Random.FRandRange(200.0f, 800.0f);
+	const float Thickness	= Random.FRandRange(50.0f, 150.0f);
+	const float Height		= Random.FRandRange(180.0f, 320.0f);
+
+	const FVector WallExtent(Thickness, Length, Height * 0.5f);
+	AddBox(Frame, FVector(Thickness, 0.0f, 0.0f), WallExtent);
+
+	SpawnPoints.Add(FTransform(Frame.GetRotation(), Frame.TransformPosition(FVector(-250.0f, 0.0f, 100.0f))));
+
+	switch (Random.RandRange(0, 4))
+	{
+		//Second wall in line, a side jump away.
+		case 0:
+		{
+			const float Gap = Random.FRandRange(80.0f, 220.0f);
+			AddBox(Frame, FVector(Thickness, Length * 2.0f + Gap, Random.FRandRange(-40.0f, 40.0f)), WallExtent);
+			return 2;
+		}
+
+		//Wall closing the right end into an inside corner. The ends of every box are outside corners already.
+		case 1:
+		{
+			const float SideLength = Random.FRandRange(200.0f, 600.0f);
+			AddBox(Frame, FVector(-SideLength, Length - Thickness, 0.0f), FVector(SideLength, Thickness, Height * 0.5f));
+			return 2;
+		}
+
+		//Slab sticking out over the face.
+		case 2:
+		{
+			const float Overhang = Random.FRandRange(20.0f, 80.0f);
+			AddBox(Frame, FVector(Thickness - Overhang * 0.5f, 0.0f, Height), FVector(Thickness + Overhang * 0.5f, Length, 15.0f));
+			return 2;
+		}
+
+		//Narrower wall set back on top, a jump up away.
+		case 3:
+		{
+			const float UpperHeight = Random.FRandRange(200.0f, 290.0f);
+			AddBox(Frame, FVector(Thickness * 1.5f, 0.0f, Height), FVector(Thickness * 0.5f, Length * Random.FRandRange(0.5f, 1.0f), UpperHeight * 0.5f));
+			return 2;
+		}
+
+		default:
+			return 1;
+	}
+}
@@ -0,0 +1,283 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbSoakGameMode.h"
+#include "ClimbSystem.h"
+#include "ClimbSoakBotController.h"
+#include "ClimbSoakCourse.h"
+#include "ClimbSystemCharacter.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/SpectatorPawn.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/CommandLine.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+
+static const TCHAR* SoakInvariantNames[] =
+{
+	TEXT("HangingWhileWalking"),
+	TEXT("InputLeftLocked"),
+	TEXT("LostTransitionCallback"),
+	TEXT("LostGrabSnapCallback"),
+};
+
+//Only the first few violations of each kind are logged in full, the rest are counted.
+static const uint32 MaxLoggedViolations = 20;
+
+AClimbSoakGameMode::AClimbSoakGameMode()
+{
+	static_assert(ARRAY_COUNT(SoakInvariantNames) == (int32)ESoakInvariant::Count, "Every soak invariant needs a name");
+
+	PrimaryActorTick.bCanEverTick = true;
+
+	//The local player only watches.
+	DefaultPawnClass		= ASpectatorPawn::StaticClass();
+	bClimberIsDefaultPawn	= false;
+}
+
+void AClimbSoakGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
+
+	const TCHAR* CommandLine = FCommandLine::Get();
+	FParse::Value(CommandLine, TEXT("SoakClimbers="),	NumClimbers);
+	FParse::Value(CommandLine, TEXT("SoakBoxes="),		NumBoxes);
+	FParse::Value(CommandLine, TEXT("SoakSeed="),		Seed);
+	FParse::Value(CommandLine, TEXT("SoakMinutes="),	SoakMinutes);
+	FParse::Value(CommandLine, TEXT("SoakLongHangSeconds="), LongHangSeconds);
+}
+
+void AClimbSoakGameMode::StartPlay()
+{
+	Super::StartPlay();
+
+	//Far under the map, so the course never runs into what the level already has.
+	Course = GetWorld()->SpawnActor<AClimbSoakCourse>(AClimbSoakCourse::StaticClass(), FTransform(FVector(0.0f, 0.0f, -5000.0f)));
+	Course->Seed		= Seed;
+	Course->NumBoxes	= NumBoxes;
+	Course->Build();
+
+	if (IsClimberClassLoaded())
+		SpawnClimbers();
+
+	const FString FilePath = FPaths::ProjectSavedDir() / TEXT("Soak") / FString::Printf(TEXT("ClimbSoak_%s.csv"), *FDateTime::Now().ToString());
+	ReportFile = IFileManager::Get().CreateFileWriter(*FilePath, FILEWRITE_AllowRead);
+
+	if (ReportFile)
+	{
+		FTCHARToUTF8 Header(TEXT("Seconds,Climbers,AvgFrameMs,MaxFrameMs,UsedMB,Violations,Respawns,LongHangs\n"));
+		ReportFile->Serialize((void*)Header.Get(), Header.Length());
+	}
+
+	StartRealTime		= FPlatformTime::Seconds();
+	LastTickRealTime	= StartRealTime;
+	WindowStartRealTime = StartRealTime;
+
+	UE_LOG(LogClimb, Display, TEXT("ClimbSoak: seed %d, %d boxes, %d climbers, %s, report in %s"), Seed, NumBoxes, NumClimbers,
+		SoakMinutes > 0.0f ? *FString::Printf(TEXT("%.0f minutes"), SoakMinutes) : TEXT("until closed"), *FilePath);
+}
+
+void AClimbSoakGameMode::OnClimberClassLoaded()
+{
+	Super::OnClimberClassLoaded();
+
+	if (Course)
+		SpawnClimbers();
+}
+
+void AClimbSoakGameMode::SpawnClimbers()
+{
+	const TArray<FTransform>& SpawnPoints = Course->GetSpawnPoints();
+	if (SpawnPoints.Num() == 0)
+		return;
+
+	UClass* ClimberClass = GetLoadedClimberClass();
+	if (!ClimberClass || !ClimberClass->IsChildOf(AClimbSystemCharacter::StaticClass()))
+		ClimberClass = AClimbSystemCharacter::StaticClass();
+
+	FRandomStream Random(Seed);
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+	for (int32 Index = 0; Index < NumClimbers; Index++)
+	{
+		const FTransform& SpawnPoint = SpawnPoints[Random.RandRange(0, SpawnPoints.Num() - 1)];
+
+		AClimbSystemCharacter* Climber = GetWorld()->SpawnActor<AClimbSystemCharacter>(ClimberClass, SpawnPoint, SpawnParams);
+		if (!Climber)
+			continue;
+
+		AClimbSoakBotController* Bot = GetWorld()->SpawnActor<AClimbSoakBotController>(AClimbSoakBotController::StaticClass(), SpawnPoint, SpawnParams);
+		Bot->Possess(Climber);
+		Bot->SetRandomSeed(Seed + Index);
+		Bot->SetLongHang(LongHangSeconds);
+
+		FClimbSnapshot SpawnSnapshot;
+		Climber->SaveClimbSnapshot(SpawnSnapshot);
+		Bot->SetRespawn(SpawnSnapshot, Course->GetKillZ());
+
+		Bots.Add(Bot);
+	}
+
+	//Frame time with and without climb.MeshlessClimb 2 is the server cost of the animations.
+	if (Bots.Num() > 0)
+		UE_LOG(LogClimb, Display, TEXT("ClimbSoak: %d climbers of %s spawned, %s"), Bots.Num(), *ClimberClass->GetName(),
+			CastChecked<AClimbSystemCharacter>(Bots[0]->GetPawn())->IsMeshlessClimb() ? TEXT("mesh-less climb") : TEXT("animation driven climb"));
+}
+
+void AClimbSoakGameMode::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	if (bFinished)
+		return;
+
+	for (AClimbSoakBotController* Bot : Bots)
+		CheckInvariants(Bot);
+
+	const double Now			= FPlatformTime::Seconds();
+	const double FrameSeconds	= Now - LastTickRealTime;
+	LastTickRealTime			= Now;
+
+	WindowFrameSeconds		+= FrameSeconds;
+	WindowMaxFrameSeconds	= FMath::Max(WindowMaxFrameSeconds, FrameSeconds);
+	WindowFrames++;
+
+	if (Now - WindowStartRealTime >= ReportInterval)
+		WriteReport(Now);
+
+	if (SoakMinutes > 0.0f && Now - StartRealTime >= SoakMinutes * 60.0f)
+		FinishSoak();
+}
+
+void AClimbSoakGameMode::CheckInvariants(AClimbSoakBotController* Bot)
+{
+	const AClimbSystemCharacter* Climber = Cast<AClimbSystemCharacter>(Bot->GetPawn());
+	if (!Climber)
+		return;
+
+	if (Climber->IsHanging() && Climber->GetCharacterMovement()->MovementMode == MOVE_Walking)
+		ReportViolation(Bot, ESoakInvariant::HangingWhileWalking);
+
+	else if (Climber->GetClimbInputLockedTime() > MaxInputLockSeconds)
+		ReportViolation(Bot, ESoakInvariant::InputLeftLocked);
+
+	else if (Climber->GetPendingTransitionTime() > MaxTransitionSeconds)
+		ReportViolation(Bot, ESoakInvariant::LostTransitionCallback);
+
+	else if (Climber->GetGrabSnapTime() > MaxGrabSnapSeconds)
+		ReportViolation(Bot, ESoakInvariant::LostGrabSnapCallback);
+}
+
+void AClimbSoakGameMode::ReportViolation(AClimbSoakBotController* Bot, ESoakInvariant Invariant)
+{
+	const uint32 Count = ++Violations[(int32)Invariant];
+
+	if (Count <= MaxLoggedViolations)
+	{
+		FClimbSnapshot Snapshot;
+		const AClimbSystemCharacter* Climber = CastChecked<AClimbSystemCharacter>(Bot->GetPawn());
+		Climber->SaveClimbSnapshot(Snapshot);
+
+		UE_LOG(LogClimb, Error, TEXT("ClimbSoak: %s on %s at %s (flags 0x%02x, movement mode %d, transition %d)%s"),
+			SoakInvariantNames[(int32)Invariant], *Climber->GetName(), *Snapshot.Location.ToString(), Snapshot.Flags, Snapshot.MovementMode,
+			(int32)Snapshot.Transition, Count == MaxLoggedViolations ? TEXT(", further ones are only counted") : TEXT(""));
+	}
+
+	//Put the climber back on its feet so one stuck bot doesn't report the same thing every frame.
+	Bot->Respawn();
+}
+
+void AClimbSoakGameMode::WriteReport(double Now)
+{
+	const double AvgFrameMs = WindowFrames > 0 ? WindowFrameSeconds * 1000.0 / WindowFrames : 0.0;
+	const double MaxFrameMs = WindowMaxFrameSeconds * 1000.0;
+	const double UsedMB		= FPlatformMemory::GetStats().UsedPhysical / (1024.0 * 1024.0);
+
+	int32 NumRespawns	= 0;
+	int32 NumLongHangs	= 0;
+
+	for (const AClimbSoakBotController* Bot : Bots)
+	{
+		NumRespawns		+= Bot->GetNumRespawns();
+		NumLongHangs	+= Bot->GetNumLongHangs();
+	}
+
+	//The first sample is warm up, the second one is what later samples are compared to.
+	NumReports++;
+	if (NumReports == 2)
+	{
+		BaselineFrameMs		= AvgFrameMs;
+		BaselineMemoryMB	= UsedMB;
+	}
+
+	const double FrameDrift		= BaselineFrameMs > 0.0 ? AvgFrameMs / BaselineFrameMs - 1.0 : 0.0;
+	const double MemoryDrift	= NumReports >= 2 ? UsedMB - BaselineMemoryMB : 0.0;
+
+	UE_LOG(LogClimb, Display, TEXT("ClimbSoak: %.0f s, %d climbers, %.2f ms avg, %.2f ms max, %.1f MB (%+.1f%% frame time, %+.1f MB), %u violations, %d respawns, %d long hangs"),
+		Now - StartRealTime, Bots.Num(), AvgFrameMs, MaxFrameMs, UsedMB, FrameDrift * 100.0, MemoryDrift, GetNumViolations(), NumRespawns, NumLongHangs);
+
+	if (FrameDrift > MaxFrameTimeDrift || MemoryDrift > MaxMemoryDriftMB)
+	{
+		NumDriftReports++;
+		UE_LOG(LogClimb, Warning, TEXT("ClimbSoak: drift over the first sample (%+.1f%% frame time, %+.1f MB)"), FrameDrift * 100.0, MemoryDrift);
+	}
+
+	if (ReportFile)
+	{
+		FTCHARToUTF8 Line(*FString::Printf(TEXT("%.0f,%d,%.3f,%.3f,%.1f,%u,%d,%d\n"), Now - StartRealTime, Bots.Num(), AvgFrameMs, MaxFrameMs, UsedMB,
+			GetNumViolations(), NumRespawns, NumLongHangs));
+		ReportFile->Serialize((void*)Line.Get(), Line.Length());
+		ReportFile->Flush();
+	}
+
+	WindowStartRealTime		= Now;
+	WindowFrameSeconds		= 0.0;
+	WindowMaxFrameSeconds	= 0.0;
+	WindowFrames			= 0;
+}
+
+void AClimbSoakGameMode::FinishSoak()
+{
+	bFinished = true;
+	WriteReport(FPlatformTime::Seconds());
+
+	for (int32 Invariant = 0; Invariant < (int32)ESoakInvariant::Count; Invariant++)
+		UE_LOG(LogClimb, Display, TEXT("ClimbSoak: %-24s %u"), SoakInvariantNames[Invariant], Violations[Invariant]);
+
+	//Without a hang held past the limit, a grab snap that never lands looks the same as one that does.
+	int32 NumLongHangs = 0;
+	for (const AClimbSoakBotController* Bot : Bots)
+		NumLongHangs += Bot->GetNumLongHangs();
+
+	if (LongHangSeconds <= MaxGrabSnapSeconds || NumLongHangs == 0)
+		UE_LOG(LogClimb, Warning, TEXT("ClimbSoak: no hang was held past MaxGrabSnapSeconds (%.1f s), %s went unchecked"), MaxGrabSnapSeconds,
+			SoakInvariantNames[(int32)ESoakInvariant::LostGrabSnapCallback]);
+
+	const bool bPassed = GetNumViolations() == 0 && NumDriftReports == 0;
+	UE_LOG(LogClimb, Display, TEXT("ClimbSoak: %s, %u violations, %d drift reports"), bPassed ? TEXT("PASSED") : TEXT("FAILED"), GetNumViolations(), NumDriftReports);
+
+	FPlatformMisc::RequestExit(false);
+}
+
+void AClimbSoakGameMode::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	delete ReportFile;
+	ReportFile = nullptr;
+
+	Super::EndPlay(EndPlayReason);
+}
+
+uint32 AClimbSoakGameMode::GetNumViolations() const
+{
+	uint32 Total = 0;
+	for (uint32 Count : Violations)
+		Total += Count;
+
+	return Total;
+}
@@ -4,6 +4,14 @@
 //+---------------------------------------------------------+
 
 #include "ClimbSystemCharacter.h"
+#include "ClimbSystem.h"
+#include "ClimbCoreBridge.h"
+#include "ClimbSettings.h"
+#include "ClimbLedgePath.h"
+#include "ClimbableVolume.h"
+#include "ClimbAssetSubsystem.h"
+#include "ClimbNavLinks.h"
+#include "EngineUtils.h"
 #include "HeadMountedDisplayFunctionLibrary.h"
 #include "Camera/CameraComponent.h"
 #include "Components/CapsuleComponent.h"
@@ -13,8 +21,37 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Kismet/GameplayStatics.h"
+#include "TimerManager.h"
+#include "HAL/IConsoleManager.h"
 #include "GameFramework/SpringArmComponent.h"
-
+#include "Animation/AnimMontage.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/PlayerInput.h"
+
+DECLARE_CYCLE_STAT(TEXT("Climb Update"),				STAT_ClimbUpdate,			STATGROUP_Climb);
+DECLARE_CYCLE_STAT(TEXT("Climb Broad Phase Gather"),	STAT_ClimbBroadPhaseGather,	STATGROUP_Climb);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Climb Scene Queries"),	STAT_ClimbSceneQueries,		STATGROUP_Climb);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Climb Candidates"),	STAT_ClimbCandidates,		STATGROUP_Climb);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Active Climbers"),	STAT_ClimbActiveClimbers,	STATGROUP_Climb);
+
+static uint32 ClimbSensingActivations = 0;
+
+static TAutoConsoleVariable<int32> CVarClimbMeshlessClimb(
+	TEXT("climb.MeshlessClimb"),
+	1,
+	TEXT("Runs the climb off the capsule and timing tables, without evaluating the mesh pose or its anim instance. Read when a climber begins play.\n")
+	TEXT(" 0: never\n")
+	TEXT(" 1: on dedicated servers (default)\n")
+	TEXT(" 2: always, for headless benchmarks"),
+	ECVF_Default);
+
+//Names used every frame, looked up once.
+static const FName NAME_ClimbMoveRight(TEXT("MoveRight"));
+static const FName NAME_ClimbPelvisSocket(TEXT("PelvisSocket"));
+static const FName NAME_LedgeMovementFinished(TEXT("LedgeMovementFinished"));
+
+//Added around the probes when gathering broad phase candidates, so a hit right at the end of a probe is not lost.
+static const float ClimbBroadPhaseMargin = 20.0f;
 
 AClimbSystemCharacter::AClimbSystemCharacter()
 {
@@ -47,54 +84,159 @@ AClimbSystemCharacter::AClimbSystemCharacter()
 	//Right Arrow Component. Used when the player is hanging and moving.
 	RightArrow = CreateDefaultSubobject<UArrowComponent>(TEXT("RightArrow"));
 	RightArrow->SetupAttachment(GetCapsuleComponent());
-	RightArrow->SetRelativeLocation(FVector(40.0f, 70.0f, 40.0f));
+	RightArrow->SetRelativeLocation(ClimbCore::ToEngine(ClimbCore::Rules::RightArrowOffset));
 
 	//Left Arrow Component. Used when the player is hanging and moving.
 	LeftArrow = CreateDefaultSubobject<UArrowComponent>(TEXT("LeftArrow"));
 	LeftArrow->SetupAttachment(GetCapsuleComponent());
-	LeftArrow->SetRelativeLocation(FVector(40.0f, -70.0f, 40.0f));
+	LeftArrow->SetRelativeLocation(ClimbCore::ToEngine(ClimbCore::Rules::LeftArrowOffset));
 
 	//RightLedge Arrow Component. Used when the player is trying to jump from wall to another.
 	RightLedge = CreateDefaultSubobject<UArrowComponent>(TEXT("RightLedge"));
 	RightLedge->SetupAttachment(GetCapsuleComponent());
-	RightLedge->SetRelativeLocation(FVector(50.0f, 150.0f, 40.0f));
+	RightLedge->SetRelativeLocation(ClimbCore::ToEngine(ClimbCore::Rules::RightLedgeOffset));
 
 	//LeftLedge Arrow Component. Used when the player is trying to jump from wall to another.
 	LeftLedge = CreateDefaultSubobject<UArrowComponent>(TEXT("LeftLedge"));
 	LeftLedge->SetupAttachment(GetCapsuleComponent());
-	LeftLedge->SetRelativeLocation(FVector(50.0f, -150.0f, 40.0f));
+	LeftLedge->SetRelativeLocation(ClimbCore::ToEngine(ClimbCore::Rules::LeftLedgeOffset));
 
 	//Up Arrow Component. Used when the player jumps up.
 	UpArrow = CreateDefaultSubobject<UArrowComponent>(TEXT("UpArrow"));
 	UpArrow->SetupAttachment(GetCapsuleComponent());
-	UpArrow->SetRelativeLocation(FVector(65.0f, 0.0f, 290.0f));
+	UpArrow->SetRelativeLocation(ClimbCore::ToEngine(ClimbCore::Rules::UpArrowOffset));
 }
 
 void AClimbSystemCharacter::BeginPlay()
 {
+	LLM_SCOPE_CLIMB();
+
 	Super::BeginPlay();
 	MyCharacterMesh = FindComponentByClass<USkeletalMeshComponent>();
+
+	const int32 MeshlessClimb	= CVarClimbMeshlessClimb.GetValueOnGameThread();
+	bMeshlessClimb				= !MyCharacterMesh || MeshlessClimb == 2 || (MeshlessClimb == 1 && IsRunningDedicatedServer());
+
+	//Nothing climbing needs comes from the pose any more, so it is only evaluated where someone can see it.
+	if (bMeshlessClimb && MyCharacterMesh)
+		MyCharacterMesh->VisibilityBasedAnimTickOption = EVisibilityBasedAnimTickOption::OnlyTickPoseWhenRendered;
+
+	ClimbProbeQueryParams	= FCollisionQueryParams(SCENE_QUERY_STAT(ClimbProbe), false, this);
+	LedgePathQueryParams	= FCollisionQueryParams(SCENE_QUERY_STAT(ClimbLedgePath), false, this);
+	BroadPhaseQueryParams	= FCollisionQueryParams(SCENE_QUERY_STAT(ClimbBroadPhase), false, this);
+
+	//Every grab snap of this character runs as the same latent action, so there is never more than one moving the capsule.
+	GrabSnapUUID = GiveMeAnUUIDNumber();
+
+	//Levels without climbable volumes keep probing everywhere.
+	bClimbSensingGated = bSenseOnlyInClimbableVolumes && TActorIterator<AClimbableVolume>(GetWorld());
+
+	TArray<AActor*> Volumes;
+	GetOverlappingActors(Volumes, AClimbableVolume::StaticClass());
+	OverlappingClimbableVolumes = Volumes.Num();
+
+	//Climbers of the same class share one load, later ones usually find the assets ready.
+	if (UClimbAssetSubsystem* ClimbAssets = GetGameInstance() ? GetGameInstance()->GetSubsystem<UClimbAssetSubsystem>() : nullptr)
+		bClimbAssetsReady = ClimbAssets->RequestClimbAssets(GetClass(), FSimpleDelegate::CreateUObject(this, &AClimbSystemCharacter::OnClimbAssetsLoaded));
+
+	INC_DWORD_STAT(STAT_ClimbActiveClimbers);
+	SetClimbSensingActive(ShouldSenseClimb());
+
+	if (FClimbTelemetry::IsEnabled())
+		ClimbTelemetry = FClimbTelemetry::OpenChannel(GetName());
+
+	if (UAnimInstance* AnimInstance = MyCharacterMesh ? MyCharacterMesh->GetAnimInstance() : nullptr)
+	{
+		AnimInstance->OnPlayMontageNotifyBegin.AddDynamic(this, &AClimbSystemCharacter::OnClimbMontageNotifyBegin);
+		AnimInstance->OnMontageStarted.AddDynamic(this, &AClimbSystemCharacter::OnClimbMontageStarted);
+		AnimInstance->OnMontageBlendingOut.AddDynamic(this, &AClimbSystemCharacter::OnClimbMontageBlendingOut);
+	}
+}
+
+void AClimbSystemCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (bClimbSensingActive)
+		DEC_DWORD_STAT(STAT_ClimbActiveClimbers);
+
+	FClimbTelemetry::CloseChannel(ClimbTelemetry);
+	ClimbTelemetry.Reset();
+
+	Super::EndPlay(EndPlayReason);
 }
 
 void AClimbSystemCharacter::Tick(float DeltaSeconds)
 {
+	LLM_SCOPE_CLIMB();
+
 	Super::Tick(DeltaSeconds);
-	ForwardTracer();
-	HeightTracer();
-	JumpUpTracer();
-	MoveSides();
-	CheckForJumpOnTheSides();
+
+	//Only the climb sensing is switched off away from climbable geometry, the actor and Blueprint tick keep running.
+	if (!bClimbSensingActive)
+		return;
+
+	UpdateClimb();
+
+	//Right after the probes, so a buffered action lands on the frame its move becomes possible.
+	if (ClimbActionBuffer.Num() > 0)
+		ProcessClimbActionBuffer();
+
+	if (!ShouldSenseClimb())
+		SetClimbSensingActive(false);
+}
+
+void AClimbSystemCharacter::UnPossessed()
+{
+	if (APlayerController* PlayerController = Cast<APlayerController>(Controller))
+	{
+		if (ClimbActionInput)
+			PlayerController->PopInputComponent(ClimbActionInput);
+	}
+
+	ClimbActionBuffer.Reset();
+
+	Super::UnPossessed();
+}
+
+void AClimbSystemCharacter::NotifyActorBeginOverlap(AActor* OtherActor)
+{
+	Super::NotifyActorBeginOverlap(OtherActor);
+
+	if (Cast<AClimbableVolume>(OtherActor))
+	{
+		OverlappingClimbableVolumes++;
+		SetClimbSensingActive(true);
+	}
+}
+
+void AClimbSystemCharacter::NotifyActorEndOverlap(AActor* OtherActor)
+{
+	Super::NotifyActorEndOverlap(OtherActor);
+
+	//Tick switches sensing off once any climb in progress is over.
+	if (Cast<AClimbableVolume>(OtherActor))
+		OverlappingClimbableVolumes = FMath::Max(OverlappingClimbableVolumes - 1, 0);
 }
 
 void AClimbSystemCharacter::SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent)
 {
 	check(PlayerInputComponent);
-	
-	PlayerInputComponent->BindAction("Jump",		IE_Pressed, this, &AClimbSystemCharacter::CheckForJump);
-	PlayerInputComponent->BindAction("ExitClimb",	IE_Pressed, this, &AClimbSystemCharacter::CheckForTurnBackOrExit);
-	PlayerInputComponent->BindAction("LeftCorner",	IE_Pressed, this, &AClimbSystemCharacter::TurnToWallLeftCorner);
-	PlayerInputComponent->BindAction("RightCorner", IE_Pressed, this, &AClimbSystemCharacter::TurnToWallRightCorner);	
-	PlayerInputComponent->BindAction("Forward",		IE_Pressed, this, &AClimbSystemCharacter::CharacterTurnForward);
+	LLM_SCOPE_CLIMB();
+
+	APlayerController* PlayerController = Cast<APlayerController>(Controller);
+
+	if (ClimbActionInput && PlayerController)
+		PlayerController->PopInputComponent(ClimbActionInput);
+
+	ClimbActionInput = NewObject<UInputComponent>(this, TEXT("ClimbActionInput"));
+
+	BindClimbAction("Jump",			EClimbAction::Jump);
+	BindClimbAction("ExitClimb",	EClimbAction::ExitClimb);
+	BindClimbAction("LeftCorner",	EClimbAction::LeftCorner);
+	BindClimbAction("RightCorner",	EClimbAction::RightCorner);
+	BindClimbAction("Forward",		EClimbAction::Forward);
+
+	if (PlayerController)
+		PlayerController->PushInputComponent(ClimbActionInput);
 
 	PlayerInputComponent->BindAxis("MoveForward",	this, &AClimbSystemCharacter::MoveForward);
 	PlayerInputComponent->BindAxis("MoveRight",		this, &AClimbSystemCharacter::MoveRight);
@@ -147,65 +289,850 @@ void AClimbSystemCharacter::MoveRight(float Value)
 }
 
 void AClimbSystemCharacter::CheckForJump()
+{
+	ClimbCore::FJumpInput JumpInput;
+	JumpInput.bIsHanging	= bCharacterIsHanging;
+	JumpInput.bTurnedBack	= bTurnedBack;
+	JumpInput.bIsJumping	= bIsJumping;
+	JumpInput.bCanJumpRight	= bCanJumpRight;
+	JumpInput.bCanJumpLeft	= bCanJumpLeft;
+	JumpInput.bCanJumpUp	= bCanJumpUp;
+	JumpInput.MoveRightAxis	= GetClimbMoveRightInput();
+
+	switch (ClimbCore::DecideJumpAction(JumpInput))
+	{
+		case ClimbCore::EJumpAction::Jump:			Jump();						break;
+		case ClimbCore::EJumpAction::ClimbLedge:	ClimbLedge();				break;
+		case ClimbCore::EJumpAction::JumpRight:		JumpRightLeftLedge(true);	break;
+		case ClimbCore::EJumpAction::JumpLeft:		JumpRightLeftLedge(false);	break;
+		case ClimbCore::EJumpAction::JumpUp:		JumpUpLedge();				break;
+		case ClimbCore::EJumpAction::JumpBack:		JumpBack();					break;
+		default:																break;
+	}
+}
+
+void AClimbSystemCharacter::CheckForTurnBackOrExit()
 {
 	if (bCharacterIsHanging)
 	{
-		if (!bTurnedBack)
+		if (bTurnedBack)
 		{
-			if (bCanJumpRight)
-			{
-				if (GetInputAxisValue("MoveRight") > 0)
-					JumpRightLeftLedge(true);
-				else
-					ClimbLedge();
-			}
+			bTurnedBack = false;
 			
-			else
+			if (UAnimInstance* AnimListener = GetClimbAnimListener())
+				IClimbInterface::Execute_TurnBack(AnimListener, false);
+
+			ExitClimb();
+		}
+		else
+			CharacterTurnBack();
+	}
+}
+
+#pragma endregion
+
+#pragma region Climb Input
+
+float AClimbSystemCharacter::GetClimbMoveRightInput() const
+{
+	return bHasClimbMoveRightInput ? ClimbMoveRightInput : GetInputAxisValue(NAME_ClimbMoveRight);
+}
+
+void AClimbSystemCharacter::SetClimbMoveRightInput(float Value)
+{
+	ClimbMoveRightInput		= FMath::Clamp(Value, -1.0f, 1.0f);
+	bHasClimbMoveRightInput = true;
+}
+
+bool AClimbSystemCharacter::RequestClimbAction(EClimbAction Action)
+{
+	LLM_SCOPE_CLIMB();
+
+	//Older presses go first, so a ready action still waits behind them.
+	if (ClimbActionBuffer.Num() == 0 && CanRunClimbAction(Action))
+	{
+		RunClimbAction(Action);
+		return true;
+	}
+
+	if (FClimbProbeSettings::Get().InputBufferWindow <= 0.0f)
+	{
+		RecordClimbEvent(EClimbTelemetryEvent::InputRejected);
+		return false;
+	}
+
+	if (ClimbActionBuffer.Num() >= ClimbCore::Rules::MaxBufferedActions)
+	{
+		ClimbActionBuffer.RemoveAt(0, 1, false);
+		RecordClimbEvent(EClimbTelemetryEvent::InputRejected);
+	}
+
+	FClimbBufferedAction BufferedAction;
+	BufferedAction.Time		= GetWorld()->GetTimeSeconds();
+	BufferedAction.Action	= Action;
+
+	ClimbActionBuffer.Add(BufferedAction);
+	ProcessClimbActionBuffer();
+
+	return false;
+}
+
+bool AClimbSystemCharacter::CanRunClimbAction(EClimbAction Action) const
+{
+	//Corner turns and jump ups lock every climb action until they give the input back.
+	if (bClimbInputDisabled)
+		return false;
+
+	switch (Action)
+	{
+		case EClimbAction::Jump:
+		{
+			ClimbCore::FJumpInput JumpInput;
+			JumpInput.bIsHanging	= bCharacterIsHanging;
+			JumpInput.bTurnedBack	= bTurnedBack;
+			JumpInput.bIsJumping	= bIsJumping;
+			JumpInput.bCanJumpRight	= bCanJumpRight;
+			JumpInput.bCanJumpLeft	= bCanJumpLeft;
+			JumpInput.bCanJumpUp	= bCanJumpUp;
+			JumpInput.MoveRightAxis	= GetClimbMoveRightInput();
+
+			return ClimbCore::DecideJumpAction(JumpInput) != ClimbCore::EJumpAction::None;
+		}
+
+		case EClimbAction::ExitClimb:	return bCharacterIsHanging;
+		case EClimbAction::LeftCorner:	return bCharacterIsHanging && !bCanJumpLeft && bCanTurnLeft;
+		case EClimbAction::RightCorner:	return bCharacterIsHanging && !bCanJumpRight && bCanTurnRight;
+		case EClimbAction::Forward:		return bTurnedBack;
+		default:						return false;
+	}
+}
+
+void AClimbSystemCharacter::RunClimbAction(EClimbAction Action)
+{
+	switch (Action)
+	{
+		case EClimbAction::Jump:		CheckForJump();				break;
+		case EClimbAction::ExitClimb:	CheckForTurnBackOrExit();	break;
+		case EClimbAction::LeftCorner:	TurnToWallLeftCorner();		break;
+		case EClimbAction::RightCorner: TurnToWallRightCorner();	break;
+		case EClimbAction::Forward:		CharacterTurnForward();		break;
+		default:													break;
+	}
+}
+
+void AClimbSystemCharacter::ProcessClimbActionBuffer()
+{
+	const float Now		= GetWorld()->GetTimeSeconds();
+	const float Window	= FClimbProbeSettings::Get().InputBufferWindow;
+
+	for (int32 Index = 0; Index < ClimbActionBuffer.Num();)
+	{
+		const FClimbBufferedAction BufferedAction = ClimbActionBuffer[Index];
+
+		if (CanRunClimbAction(BufferedAction.Action))
+		{
+			ClimbActionBuffer.RemoveAt(Index, 1, false);
+			RunClimbAction(BufferedAction.Action);
+
+			//The action changed the climb state, so the older ones that were waiting get another look.
+			Index = 0;
+		}
+		else if (Now - BufferedAction.Time > Window)
+		{
+			ClimbActionBuffer.RemoveAt(Index, 1, false);
+			RecordClimbEvent(EClimbTelemetryEvent::InputRejected);
+		}
+		else
+			Index++;
+	}
+}
+
+void AClimbSystemCharacter::BindClimbAction(FName ActionName, EClimbAction Action)
+{
+	ClimbActionInput->BindAction<FClimbActionDelegate>(ActionName, IE_Pressed, this, &AClimbSystemCharacter::OnClimbActionPressed, Action);
+}
+
+void AClimbSystemCharacter::OnClimbActionPressed(EClimbAction Action)
+{
+	RequestClimbAction(Action);
+}
+
+float AClimbSystemCharacter::GetClimbInputLockedTime() const
+{
+	return bClimbInputDisabled ? GetWorld()->GetTimeSeconds() - InputLockStartTime : 0.0f;
+}
+
+float AClimbSystemCharacter::GetPendingTransitionTime() const
+{
+	const bool bTransitionPending = ActiveTransition != EClimbTransition::None || bPendingGrabLedge || bPendingInputEnable;
+	return bTransitionPending ? GetWorld()->GetTimeSeconds() - TransitionStartTime : 0.0f;
+}
+
+float AClimbSystemCharacter::GetGrabSnapTime() const
+{
+	return bGrabSnapping ? GetWorld()->GetTimeSeconds() - GrabSnapStartTime : 0.0f;
+}
+
+#pragma endregion
+
+#pragma region Probes
+
+void AClimbSystemCharacter::UpdateClimb()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ClimbUpdate);
+	LLM_SCOPE_CLIMB();
+
+	ClimbProbeFrame++;
+
+#if WITH_GAMEPLAY_DEBUGGER
+	const int32 HistoryFrame = ClimbProbeFrame % FClimbProbeHistory::NumFrames;
+
+	for (FClimbProbeHistory& History : ProbeHistory)
+	{
+		History.Microseconds[HistoryFrame]	= 0.0f;
+		History.Outcomes[HistoryFrame]		= FClimbProbeHistory::NotRun;
+	}
+#endif
+
+	//Climb nav links already carry everything the probes would find.
+	if (bClimbTraversalActive)
+		return;
+
+	if (ProbeMode == EClimbProbeMode::BroadPhase)
+		GatherClimbCandidates();
+
+	ForwardTracer();
+	HeightTracer();
+	JumpUpTracer();
+	MoveSides();
+	CheckForJumpOnTheSides();
+}
+
+void AClimbSystemCharacter::GetClimbProbeQuery(EClimbProbe Probe, FVector& OutStart, FVector& OutEnd, FCollisionShape& OutShape) const
+{
+	namespace Rules = ClimbCore::Rules;
+
+	const FClimbProbeSettings& Settings = FClimbProbeSettings::Get();
+	const FCollisionShape ProbeSphere	= Settings.bSimpleShapes ? FCollisionShape() : FCollisionShape::MakeSphere(Settings.ProbeSphereRadius);
+
+	switch (Probe)
+	{
+		case EClimbProbe::Forward:
+		{
+			const FVector TempForwardVector = UKismetMathLibrary::GetForwardVector(GetActorRotation());
+
+			OutStart	= GetActorLocation();
+			OutEnd		= GetActorLocation() + FVector(TempForwardVector.X * Settings.ForwardProbeLength, TempForwardVector.Y * Settings.ForwardProbeLength, TempForwardVector.Z);
+			OutShape	= ProbeSphere;
+			break;
+		}
+
+		case EClimbProbe::Height:
+		{
+			OutStart	= FVector(GetActorLocation().X, GetActorLocation().Y, GetActorLocation().Z + Settings.HeightProbeStart) +
+						  FVector(UKismetMathLibrary::GetForwardVector(GetActorRotation()) * Rules::HeightProbeForward);
+			OutEnd		= FVector(OutStart.X, OutStart.Y, OutStart.Z - Settings.HeightProbeStart);
+			OutShape	= ProbeSphere;
+			break;
+		}
+
+		case EClimbProbe::JumpUp:
+		{
+			OutStart	= UpArrow->GetComponentLocation();
+			OutEnd		= OutStart;
+			OutShape	= FCollisionShape::MakeCapsule(Settings.UpCapsuleRadius, Settings.UpCapsuleHalfHeight);
+			break;
+		}
+
+		case EClimbProbe::MoveRight:
+		case EClimbProbe::MoveLeft:
+		{
+			const UArrowComponent* Arrow = Probe == EClimbProbe::MoveRight ? RightArrow : LeftArrow;
+
+			OutStart	= Arrow->GetComponentLocation();
+			OutEnd		= OutStart;
+			OutShape	= FCollisionShape::MakeCapsule(Settings.SideCapsuleRadius, Settings.SideCapsuleHalfHeight);
+			break;
+		}
+
+		case EClimbProbe::JumpRight:
+		case EClimbProbe::JumpLeft:
+		{
+			const UArrowComponent* Arrow = Probe == EClimbProbe::JumpRight ? RightLedge : LeftLedge;
+
+			OutStart	= Arrow->GetComponentLocation();
+			OutEnd		= OutStart;
+			OutShape	= FCollisionShape::MakeCapsule(Settings.LedgeCapsuleRadius, Settings.LedgeCapsuleHalfHeight);
+			break;
+		}
+
+		case EClimbProbe::CornerRight:
+		case EClimbProbe::CornerLeft:
+		default:
+		{
+			const UArrowComponent* Arrow = Probe == EClimbProbe::CornerRight ? RightArrow : LeftArrow;
+
+			OutStart	= UKismetMathLibrary::MakeVector(Arrow->GetComponentLocation().X,
+						  Arrow->GetComponentLocation().Y, Arrow->GetComponentLocation().Z + Rules::CornerProbeRise);
+			OutEnd		= OutStart + (Arrow->GetForwardVector() * Settings.CornerProbeLength);
+			OutShape	= ProbeSphere;
+			break;
+		}
+	}
+}
+
+bool AClimbSystemCharacter::ClimbProbe(EClimbProbe Probe, FHitResult& OutHit)
+{
+	if (!IsClimbProbeActive(Probe))
+		return false;
+
+	const FClimbProbeSettings& Settings = FClimbProbeSettings::Get();
+	FClimbProbeResult& Result			= ProbeResults[(uint8)Probe];
+
+	//Lower tiers reuse the last answer for a few frames. The height probe has a narrow grab window, so it always runs.
+	if (Result.bValid && Probe != EClimbProbe::Height && ClimbProbeFrame - Result.Frame < (uint32)Settings.ProbeInterval)
+	{
+		OutHit = Result.Hit;
+#if WITH_GAMEPLAY_DEBUGGER
+		RecordClimbProbeHistory(Probe, FClimbProbeHistory::Reused, 0);
+#endif
+		return Result.bHit;
+	}
+
+#if WITH_GAMEPLAY_DEBUGGER
+	const uint64 ProbeStartCycles = FPlatformTime::Cycles64();
+#endif
+
+	FVector StartVector;
+	FVector EndVector;
+	FCollisionShape ProbeShape;
+	GetClimbProbeQuery(Probe, StartVector, EndVector, ProbeShape);
+
+	Result.Frame	= ClimbProbeFrame;
+	Result.bValid	= true;
+
+	if (ProbeMode == EClimbProbeMode::BroadPhase)
+		Result.bHit = ClimbProbeAgainstCandidates(StartVector, EndVector, ProbeShape, Result.Hit);
+
+	//Async probes answer with the query sent last time and queue the next one. Until that one is done, the old answer stays.
+	//The height probe stays blocking, a one frame late ledge would miss its grab window just like a reused one.
+	else if (Settings.bAsyncProbes && Probe != EClimbProbe::Height)
+	{
+		if (Result.AsyncHandle.IsValid() && GetWorld()->QueryTraceData(Result.AsyncHandle, AsyncProbeDatum))
+		{
+			Result.bHit = AsyncProbeDatum.OutHits.Num() > 0 && AsyncProbeDatum.OutHits[0].bBlockingHit;
+
+			if (Result.bHit)
+				Result.Hit = AsyncProbeDatum.OutHits[0];
+		}
+
+		INC_DWORD_STAT(STAT_ClimbSceneQueries);
+		Result.AsyncHandle = GetWorld()->AsyncSweepByChannel(EAsyncTraceType::Single, StartVector, EndVector, ECC_GameTraceChannel1, ProbeShape, ClimbProbeQueryParams);
+	}
+
+	else
+	{
+		INC_DWORD_STAT(STAT_ClimbSceneQueries);
+		Result.bHit = GetWorld()->SweepSingleByChannel(Result.Hit, StartVector, EndVector, FQuat::Identity, ECC_GameTraceChannel1, ProbeShape, ClimbProbeQueryParams);
+	}
+
+	OutHit = Result.Hit;
+#if WITH_GAMEPLAY_DEBUGGER
+	RecordClimbProbeHistory(Probe, Result.bHit ? FClimbProbeHistory::Hit : FClimbProbeHistory::Missed, FPlatformTime::Cycles64() - ProbeStartCycles);
+#endif
+	return Result.bHit;
+}
+
+#if WITH_GAMEPLAY_DEBUGGER
+void AClimbSystemCharacter::RecordClimbProbeHistory(EClimbProbe Probe, FClimbProbeHistory::EOutcome Outcome, uint64 Cycles)
+{
+	FClimbProbeHistory& History = ProbeHistory[(uint8)Probe];
+	const int32 HistoryFrame	= ClimbProbeFrame % FClimbProbeHistory::NumFrames;
+
+	//Async probes only pay for sending the query here, the sweep itself runs on the physics thread.
+	History.Microseconds[HistoryFrame]	= (float)(FPlatformTime::ToMilliseconds64(Cycles) * 1000.0);
+	History.Outcomes[HistoryFrame]		= Outcome;
+}
+#endif
+
+bool AClimbSystemCharacter::IsClimbProbeActive(EClimbProbe Probe) const
+{
+	return (FClimbProbeSettings::Get().ActiveProbes & (1u << (uint8)Probe)) != 0;
+}
+
+void AClimbSystemCharacter::GatherClimbCandidates()
+{
+	SCOPE_CYCLE_COUNTER(STAT_ClimbBroadPhaseGather);
+
+	ClimbOverlaps.Reset();
+	ClimbCandidates.Reset();
+
+	//The box follows the probes as the settings have them this frame: lengths, shapes and which ones run.
+	FBox ProbeBounds(ForceInit);
+
+	for (uint8 Probe = 0; Probe < (uint8)EClimbProbe::Count; Probe++)
+	{
+		if (!IsClimbProbeActive((EClimbProbe)Probe))
+			continue;
+
+		FVector Start;
+		FVector End;
+		FCollisionShape Shape;
+		GetClimbProbeQuery((EClimbProbe)Probe, Start, End, Shape);
+
+		const FVector ShapeExtent = Shape.GetExtent();
+		ProbeBounds += FBox(Start - ShapeExtent, Start + ShapeExtent);
+		ProbeBounds += FBox(End - ShapeExtent, End + ShapeExtent);
+	}
+
+	if (!ProbeBounds.IsValid)
+		return;
+
+	ProbeBounds = ProbeBounds.ExpandBy(ClimbBroadPhaseMargin);
+
+	INC_DWORD_STAT(STAT_ClimbSceneQueries);
+
+	GetWorld()->OverlapMultiByChannel(ClimbOverlaps, ProbeBounds.GetCenter(), FQuat::Identity,
+									  ECC_GameTraceChannel1, FCollisionShape::MakeBox(ProbeBounds.GetExtent()), BroadPhaseQueryParams);
+
+	for (const FOverlapResult& Overlap : ClimbOverlaps)
+	{
+		UPrimitiveComponent* Component = Overlap.GetComponent();
+
+		if (Overlap.bBlockingHit && Component)
+			ClimbCandidates.AddUnique(Component);
+	}
+
+	INC_DWORD_STAT_BY(STAT_ClimbCandidates, ClimbCandidates.Num());
+}
+
+bool AClimbSystemCharacter::ClimbProbeAgainstCandidates(const FVector& Start, const FVector& End, const FCollisionShape& Shape, FHitResult& OutHit) const
+{
+	bool bOnHit = false;
+
+	for (UPrimitiveComponent* Component : ClimbCandidates)
+	{
+		//The side, ledge and up probes don't move, they only ask if something is there.
+		if (Start == End)
+		{
+			if (Component->OverlapComponent(Start, FQuat::Identity, Shape))
 			{
-				if (bCanJumpLeft)
-				{
-					if (GetInputAxisValue("MoveRight") < 0)
-						JumpRightLeftLedge(false);
-					else
-						ClimbLedge();
-				}
-				else
-				{
-					if (bCanJumpUp)
-						JumpUpLedge();
-					else
-						ClimbLedge();
-				}
+				OutHit					= FHitResult(Component->GetOwner(), Component, Start, FVector::ZeroVector);
+				OutHit.bBlockingHit		= true;
+				OutHit.bStartPenetrating = true;
+				return true;
 			}
+			continue;
 		}
-		
-		else
+
+		FHitResult ComponentHit;
+		if (Component->SweepComponent(ComponentHit, Start, End, FQuat::Identity, Shape) && (!bOnHit || ComponentHit.Time < OutHit.Time))
+		{
+			OutHit = ComponentHit;
+			bOnHit = true;
+		}
+	}
+
+	return bOnHit;
+}
+
+double AClimbSystemCharacter::MeasureClimbProbeCost(EClimbProbeMode Mode, int32 Iterations)
+{
+	const EClimbProbeMode PreviousMode = ProbeMode;
+	ProbeMode = Mode;
+
+	FHitResult HitResult;
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+	{
+		ClimbProbeFrame++;
+
+		if (Mode == EClimbProbeMode::BroadPhase)
+			GatherClimbCandidates();
+
+		for (uint8 Probe = 0; Probe < (uint8)EClimbProbe::Count; Probe++)
+			ClimbProbe((EClimbProbe)Probe, HitResult);
+	}
+
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+	ProbeMode = PreviousMode;
+
+	return FPlatformTime::ToMilliseconds64(EndCycles - StartCycles) / FMath::Max(Iterations, 1);
+}
+
+#pragma endregion
+
+#pragma region Meshless Climb
+
+FVector AClimbSystemCharacter::GetClimbPelvisLocation() const
+{
+	if (bMeshlessClimb)
+		return GetActorTransform().TransformPosition(SimulationTimings.PelvisOffset);
+
+	return MyCharacterMesh->GetSocketLocation(NAME_ClimbPelvisSocket);
+}
+
+UAnimInstance* AClimbSystemCharacter::GetClimbAnimListener() const
+{
+	if (bMeshlessClimb)
+		return nullptr;
+
+	UAnimInstance* AnimInstance = MyCharacterMesh->GetAnimInstance();
+	return AnimInstance && AnimInstance->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()) ? AnimInstance : nullptr;
+}
+
+void AClimbSystemCharacter::SimulateClimbStep(EClimbSimulatedStep Step, float Delay)
+{
+	FTimerManager& TimerManager = GetWorldTimerManager();
+	SimulatedStepTimers.RemoveAll([&TimerManager](const FTimerHandle& Timer) { return !TimerManager.TimerExists(Timer); });
+
+	FTimerHandle& Timer = SimulatedStepTimers.AddDefaulted_GetRef();
+	TimerManager.SetTimer(Timer, FTimerDelegate::CreateUObject(this, &AClimbSystemCharacter::RunSimulatedClimbStep, Step), FMath::Max(Delay, 0.001f), false);
+}
+
+void AClimbSystemCharacter::RunSimulatedClimbStep(EClimbSimulatedStep Step)
+{
+	LLM_SCOPE_CLIMB();
+
+	namespace Rules = ClimbCore::Rules;
+
+	const FVector SideJumpOffset	= ClimbCore::ToEngine(Rules::SideJumpOffset);
+	const FVector CornerTurnOffset	= ClimbCore::ToEngine(Rules::CornerTurnOffset);
+
+	//Each step ends its transition through the same call the animation would have made.
+	switch (Step)
+	{
+		case EClimbSimulatedStep::ClimbLedge:
+		{
+			if (!bIsClimbingLedge)
+				break;
+
+			const float CapsuleRadius		= GetCapsuleComponent()->GetScaledCapsuleRadius();
+			const float CapsuleHalfHeight	= GetCapsuleComponent()->GetScaledCapsuleHalfHeight();
+			const FVector TopLocation		= WallHeightLocation - WallNormal.GetSafeNormal2D() * (Rules::LedgePathTopInset + CapsuleRadius) +
+											  FVector(0.0f, 0.0f, CapsuleHalfHeight);
+
+			SetActorLocation(TopLocation, false, nullptr, ETeleportType::TeleportPhysics);
+			IClimbInterface::Execute_CharacterClimbLedge(this, false);
+			break;
+		}
+
+		case EClimbSimulatedStep::SideJumpRight:
+			MoveClimbCapsule(SideJumpOffset, 0.0f);
+			IClimbInterface::Execute_JumpRight(this, false);
+			break;
+
+		case EClimbSimulatedStep::SideJumpLeft:
+			MoveClimbCapsule(SideJumpOffset * FVector(1.0f, -1.0f, 1.0f), 0.0f);
+			IClimbInterface::Execute_JumpLeft(this, false);
+			break;
+
+		case EClimbSimulatedStep::CornerRight:
+		case EClimbSimulatedStep::CornerLeft:
 		{
-			if (!bIsJumping)
-				JumpBack();
+			const bool bRight = Step == EClimbSimulatedStep::CornerRight;
+
+			//Around an outside corner: past the edge and into the wall depth, then facing back towards the side of the wall.
+			if (bPendingGrabLedge)
+			{
+				MoveClimbCapsule(bRight ? CornerTurnOffset : CornerTurnOffset * FVector(1.0f, -1.0f, 1.0f), bRight ? -90.0f : 90.0f);
+				LandClimbTransition();
+			}
+			break;
 		}
+
+		case EClimbSimulatedStep::CornerInput:
+			if (bPendingInputEnable)
+				EnablePlayerInputs();
+			break;
+
+		case EClimbSimulatedStep::JumpUp:
+			MoveClimbCapsule(ClimbCore::ToEngine(Rules::JumpUpOffset), 0.0f);
+			IClimbInterface::Execute_JumpUp(this, false);
+			break;
+
+		default:
+			break;
+	}
+}
+
+void AClimbSystemCharacter::MoveClimbCapsule(const FVector& Offset, float Yaw)
+{
+	const FVector NewLocation	= GetActorTransform().TransformPosition(Offset);
+	const FRotator NewRotation	= GetActorRotation() + FRotator(0.0f, Yaw, 0.0f);
+
+	SetActorLocationAndRotation(NewLocation, NewRotation, false, nullptr, ETeleportType::TeleportPhysics);
+
+	//A climb traversal already set the ledge it lands on.
+	if (bClimbTraversalActive)
+		return;
+
+	//The cached probe answers are from before the move.
+	for (FClimbProbeResult& Result : ProbeResults)
+		Result.bValid = false;
+
+	FVector Start;
+	FVector End;
+	FCollisionShape Shape;
+	FHitResult HitResult;
+
+	GetClimbProbeQuery(EClimbProbe::Forward, Start, End, Shape);
+	if (LedgePathProbe(Start, End, HitResult))
+	{
+		WallLocation	= HitResult.Location;
+		WallNormal		= HitResult.Normal;
+	}
+
+	GetClimbProbeQuery(EClimbProbe::Height, Start, End, Shape);
+	if (LedgePathProbe(Start, End, HitResult))
+		WallHeightLocation = HitResult.Location;
+}
+
+#pragma endregion
+
+#pragma region Climb Traversal
+
+bool AClimbSystemCharacter::ExecuteClimbTraversal(const FClimbTraversal& Traversal)
+{
+	//Drop downs are walked off like any ledge.
+	if (Traversal.Type == EClimbTraversal::DropDown || bClimbTraversalActive || bClimbInputDisabled || bIsClimbingLedge || bIsJumping)
+		return false;
+
+	ActiveClimbTraversal	= Traversal;
+	bClimbTraversalActive	= true;
+	bClimbTraversalLanded	= false;
+
+	//The link holds surface points, the probes hold shape centres. Grabbing the surface would put the capsule into the wall.
+	const float ProbeRadius = FClimbProbeSettings::Get().GetProbeShapeRadius();
+
+	WallLocation		= Traversal.WallLocation + Traversal.WallNormal * ProbeRadius;
+	WallNormal			= Traversal.WallNormal;
+	WallHeightLocation	= Traversal.LedgeLocation + FVector(0.0f, 0.0f, ProbeRadius);
+
+	GetCharacterMovement()->SetMovementMode(MOVE_Flying);
+
+	if (UAnimInstance* AnimListener = GetClimbAnimListener())
+		IClimbInterface::Execute_CharacterCanGrab(AnimListener, true);
+
+	if (!bCharacterIsHanging)
+	{
+		HangStartTime = GetWorld()->GetTimeSeconds();
+		RecordClimbEvent(EClimbTelemetryEvent::Grab);
+		RecordClimbEvent(EClimbTelemetryEvent::HangStart);
+	}
+
+	bCharacterIsHanging = true;
+	LedgeContactTime	= -1.0f;
+
+	ResetLedgePath();
+	SetClimbSensingActive(true);
+	GrabLedge();
+
+	return true;
+}
+
+void AClimbSystemCharacter::AdvanceClimbTraversal()
+{
+	//Hanging from the last ledge of the link, only climbing on top is left.
+	if (ActiveClimbTraversal.Type == EClimbTraversal::GrabAndClimb || bClimbTraversalLanded)
+	{
+		if (!bIsClimbingLedge)
+			ClimbLedge();
+
+		return;
+	}
+
+	const float ProbeRadius = FClimbProbeSettings::Get().GetProbeShapeRadius();
+
+	bClimbTraversalLanded	= true;
+	WallLocation			= ActiveClimbTraversal.TargetWallLocation + WallNormal * ProbeRadius;
+	WallHeightLocation		= ActiveClimbTraversal.TargetLedgeLocation + FVector(0.0f, 0.0f, ProbeRadius);
+
+	if (ActiveClimbTraversal.Type == EClimbTraversal::SideJump)
+		StartSideJump(ActiveClimbTraversal.bRight);
+	else
+		StartJumpUp();
+}
+
+#pragma endregion
+
+#pragma region Proximity Activation
+
+bool AClimbSystemCharacter::ShouldSenseClimb() const
+{
+	if (!bClimbAssetsReady)
+		return false;
+
+	if (!bClimbSensingGated || OverlappingClimbableVolumes > 0)
+		return true;
+
+	return bCharacterIsHanging || bIsClimbingLedge || bIsJumping || bPendingGrabLedge || bPendingInputEnable;
+}
+
+void AClimbSystemCharacter::SetClimbSensingActive(bool bActive)
+{
+	if (bClimbSensingActive == bActive)
+		return;
+
+	bClimbSensingActive = bActive;
+
+	if (bActive)
+	{
+		ClimbSensingActivations++;
+		INC_DWORD_STAT(STAT_ClimbActiveClimbers);
+	}
+	else
+		DEC_DWORD_STAT(STAT_ClimbActiveClimbers);
+}
+
+uint32 AClimbSystemCharacter::GetClimbSensingActivations()
+{
+	return ClimbSensingActivations;
+}
+
+void AClimbSystemCharacter::GetClimbAssetPaths(TArray<FSoftObjectPath>& OutPaths) const
+{
+	if (!CornerLeftMontage.IsNull())
+		OutPaths.AddUnique(CornerLeftMontage.ToSoftObjectPath());
+
+	if (!CornerRightMontage.IsNull())
+		OutPaths.AddUnique(CornerRightMontage.ToSoftObjectPath());
+}
+
+void AClimbSystemCharacter::OnClimbAssetsLoaded()
+{
+	bClimbAssetsReady = true;
+	SetClimbSensingActive(ShouldSenseClimb());
+}
+
+#pragma endregion
+
+#pragma region Snapshot
+
+void AClimbSystemCharacter::SaveClimbSnapshot(FClimbSnapshot& OutSnapshot) const
+{
+	const UCharacterMovementComponent* Movement = GetCharacterMovement();
+
+	OutSnapshot.Location			= GetActorLocation();
+	OutSnapshot.Rotation			= GetActorQuat();
+	OutSnapshot.Velocity			= Movement->Velocity;
+	OutSnapshot.WallLocation		= WallLocation;
+	OutSnapshot.WallNormal			= WallNormal;
+	OutSnapshot.WallHeightLocation	= WallHeightLocation;
+	OutSnapshot.HangTime			= bCharacterIsHanging ? GetWorld()->GetTimeSeconds() - HangStartTime : 0.0f;
+	OutSnapshot.MovementMode		= Movement->MovementMode;
+	OutSnapshot.Transition			= ActiveTransition;
+
+	OutSnapshot.Flags =
+		(bCharacterIsHanging	? FClimbSnapshot::Hanging				: 0) |
+		(bTurnedBack			? FClimbSnapshot::TurnedBack			: 0) |
+		(bIsJumping				? FClimbSnapshot::Jumping				: 0) |
+		(bIsClimbingLedge		? FClimbSnapshot::ClimbingLedge			: 0) |
+		(bPendingGrabLedge		? FClimbSnapshot::PendingGrabLedge		: 0) |
+		(bPendingInputEnable	? FClimbSnapshot::PendingInputEnable	: 0) |
+		(bClimbInputDisabled	? FClimbSnapshot::InputDisabled			: 0) |
+		(bGrabSnapping			? FClimbSnapshot::GrabSnapping			: 0);
+}
+
+void AClimbSystemCharacter::RestoreClimbSnapshot(const FClimbSnapshot& Snapshot)
+{
+	//Drop whatever the current state has in flight: the grab snap latent, transition montages and the input lock.
+	GetWorld()->GetLatentActionManager().RemoveActionsForObject(this);
+	StopAnimMontage();
+	ClimbTransitionMontage = nullptr;
+	ClimbActionBuffer.Reset();
+
+	for (FTimerHandle& Timer : SimulatedStepTimers)
+		GetWorldTimerManager().ClearTimer(Timer);
+
+	SimulatedStepTimers.Reset();
+	bClimbTraversalActive = false;
+
+	if (bClimbInputDisabled)
+		EnableInput(UGameplayStatics::GetPlayerController(GetWorld(), 0));
+
+	SetActorLocationAndRotation(Snapshot.Location, Snapshot.Rotation, false, nullptr, ETeleportType::TeleportPhysics);
+
+	UCharacterMovementComponent* Movement = GetCharacterMovement();
+	Movement->SetMovementMode((EMovementMode)Snapshot.MovementMode);
+	Movement->Velocity = Snapshot.Velocity;
+
+	WallLocation		= Snapshot.WallLocation;
+	WallNormal			= Snapshot.WallNormal;
+	WallHeightLocation	= Snapshot.WallHeightLocation;
+	HangStartTime		= GetWorld()->GetTimeSeconds() - Snapshot.HangTime;
+	LedgeContactTime	= -1.0f;
+
+	for (FClimbProbeResult& Result : ProbeResults)
+		Result.bValid = false;
+
+	ResetLedgePath();
+
+	bCharacterIsHanging = Snapshot.HasFlag(FClimbSnapshot::Hanging);
+	bTurnedBack			= Snapshot.HasFlag(FClimbSnapshot::TurnedBack);
+	bIsJumping			= Snapshot.HasFlag(FClimbSnapshot::Jumping);
+	bIsClimbingLedge	= Snapshot.HasFlag(FClimbSnapshot::ClimbingLedge);
+	bPendingGrabLedge	= Snapshot.HasFlag(FClimbSnapshot::PendingGrabLedge);
+	bPendingInputEnable = false;
+	bClimbInputDisabled = false;
+	bGrabSnapping		= false;
+	ActiveTransition	= EClimbTransition::None;
+
+	if (UAnimInstance* AnimListener = GetClimbAnimListener())
+	{
+		IClimbInterface::Execute_CharacterCanGrab(AnimListener, bCharacterIsHanging);
+		IClimbInterface::Execute_TurnBack(AnimListener, bTurnedBack);
+
+		if (bIsClimbingLedge)
+			IClimbInterface::Execute_CharacterClimbLedge(AnimListener, true);
+	}
+
+	//A transition restored halfway lands on the saved ledge, and a grab that was still snapping snaps again.
+	if (Snapshot.Transition != EClimbTransition::None)
+	{
+		bIsJumping			= false;
+		bPendingGrabLedge	= true;
 	}
-	
-	else
-		Jump();
+
+	if (bPendingGrabLedge)
+		LandClimbTransition();
+
+	else if (bCharacterIsHanging && Snapshot.HasFlag(FClimbSnapshot::GrabSnapping))
+		GrabLedge();
+
+	//Without an anim blueprint nothing else finishes a restored climb up.
+	if (bMeshlessClimb && bIsClimbingLedge)
+		SimulateClimbStep(EClimbSimulatedStep::ClimbLedge, SimulationTimings.ClimbLedgeTime);
+
+	SetClimbSensingActive(ShouldSenseClimb());
 }
 
-void AClimbSystemCharacter::CheckForTurnBackOrExit()
+#pragma endregion
+
+#pragma region Telemetry
+
+void AClimbSystemCharacter::RecordClimbEvent(EClimbTelemetryEvent Event, float Value)
 {
-	if (bCharacterIsHanging)
-	{
-		if (bTurnedBack)
-		{
-			bTurnedBack = false;
-			
-			if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-				IClimbInterface::Execute_TurnBack(MyCharacterMesh->GetAnimInstance(), false);
+	if (ClimbTelemetry.IsValid())
+		ClimbTelemetry->Record(Event, GetWorld()->GetTimeSeconds(), Value);
+}
 
-			ExitClimb();
-		}
-		else
-			CharacterTurnBack();
-	}
+double AClimbSystemCharacter::MeasureClimbTelemetryCost(int32 Iterations)
+{
+	//Big enough that no record is dropped, so every one pays for the enqueue.
+	FClimbTelemetryChannelPtr PreviousChannel = ClimbTelemetry;
+	ClimbTelemetry = MakeShared<FClimbTelemetryChannel, ESPMode::ThreadSafe>(GetName(), (uint32)Iterations + 1);
+
+	const uint64 StartCycles = FPlatformTime::Cycles64();
+
+	for (int32 Iteration = 0; Iteration < Iterations; Iteration++)
+		RecordClimbEvent(EClimbTelemetryEvent::Grab, (float)Iteration);
+
+	const uint64 EndCycles = FPlatformTime::Cycles64();
+	ClimbTelemetry = PreviousChannel;
+
+	return FPlatformTime::ToMilliseconds64(EndCycles - StartCycles) / FMath::Max(Iterations, 1);
 }
 
 #pragma endregion
@@ -215,20 +1142,27 @@ void AClimbSystemCharacter::CheckForTurnBackOrExit()
 void AClimbSystemCharacter::ForwardTracer()
 {
 	FHitResult HitResult;
-	
-	const FVector TempForwardVector =	UKismetMathLibrary::GetForwardVector(GetActorRotation());	
-	const FVector EndVector			=	GetActorLocation() + FVector(TempForwardVector.X * 150.0f, 
-										TempForwardVector.Y * 150.0f, TempForwardVector.Z);
 
-	const FCollisionShape MySphere	= FCollisionShape::MakeSphere(20.0f);
-	
-	const bool bOnHit =	GetWorld()->SweepSingleByChannel(HitResult, GetActorLocation(), 
-						EndVector, FQuat::Identity, ECC_GameTraceChannel1, MySphere);
-	
-	if (bOnHit)
+	if (ClimbProbe(EClimbProbe::Forward, HitResult))
 	{
-		WallLocation	= HitResult.Location;
-		WallNormal		= HitResult.Normal;
+		//On the ledge path the wall is the one at the path point, not the one in front of where the probe started.
+		if (!IsFollowingLedgePath())
+		{
+			WallLocation	= HitResult.Location;
+			WallNormal		= HitResult.Normal;
+		}
+
+		if (!bCharacterIsHanging && !bIsClimbingLedge && LedgeContactTime < 0.0f)
+		{
+			LedgeContactTime = GetWorld()->GetTimeSeconds();
+			RecordClimbEvent(EClimbTelemetryEvent::LedgeContact);
+		}
+	}
+
+	else if (!bCharacterIsHanging && LedgeContactTime >= 0.0f)
+	{
+		LedgeContactTime = -1.0f;
+		RecordClimbEvent(EClimbTelemetryEvent::MissedGrab);
 	}
 }
 
@@ -236,31 +1170,33 @@ void AClimbSystemCharacter::HeightTracer()
 {
 	FHitResult HitResult;
 
-	const FVector StartVector	=	FVector(GetActorLocation().X, GetActorLocation().Y, GetActorLocation().Z + 500.0f) +
-									FVector(UKismetMathLibrary::GetForwardVector(GetActorRotation()) * 70.0f);
-	const FVector EndVector		=	FVector(StartVector.X, StartVector.Y, StartVector.Z - 500.0f);
-
-	const FCollisionShape MySphere = FCollisionShape::MakeSphere(20.0f);
-	
-	const bool bOnHit =	GetWorld()->SweepSingleByChannel(HitResult, StartVector, 
-						EndVector, FQuat::Identity, ECC_GameTraceChannel1, MySphere);
-
-	if (bOnHit)
+	if (ClimbProbe(EClimbProbe::Height, HitResult))
 	{
-		WallHeightLocation = HitResult.Location;
+		if (!IsFollowingLedgePath())
+			WallHeightLocation = HitResult.Location;
 
-		const FVector PelvisSocketLocation	= MyCharacterMesh->GetSocketLocation("PelvisSocket");	 
-		const float rangeValue				= PelvisSocketLocation.Z - WallHeightLocation.Z;
-		const bool bInRange					= UKismetMathLibrary::InRange_FloatFloat(rangeValue, -50.0f, 0.0f, true, true);
+		const FVector PelvisSocketLocation	= GetClimbPelvisLocation();
+		const bool bInRange					= ClimbCore::IsPelvisInGrabRange(PelvisSocketLocation.Z, HitResult.Location.Z);
 
-		if (bInRange)
+		//A transition in flight is landed by its montage or its simulated step, grabbing here would end it on its first frame.
+		if (bInRange && !IsClimbTransitionInFlight())
 		{
 			if (!bIsClimbingLedge)
 			{
-				if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-					IClimbInterface::Execute_CharacterCanGrab(MyCharacterMesh->GetAnimInstance(), true);
+				if (UAnimInstance* AnimListener = GetClimbAnimListener())
+					IClimbInterface::Execute_CharacterCanGrab(AnimListener, true);
 
 					GetCharacterMovement()->SetMovementMode(MOVE_Flying);
+
+					//The height probe grabs again every frame the pelvis stays in range, only the first grab starts a hang.
+					if (!bCharacterIsHanging)
+					{
+						HangStartTime		= GetWorld()->GetTimeSeconds();
+						RecordClimbEvent(EClimbTelemetryEvent::Grab, LedgeContactTime >= 0.0f ? HangStartTime - LedgeContactTime : 0.0f);
+						RecordClimbEvent(EClimbTelemetryEvent::HangStart);
+						LedgeContactTime	= -1.0f;
+					}
+
 					bCharacterIsHanging = true;
 				
 					GrabLedge();
@@ -271,54 +1207,117 @@ void AClimbSystemCharacter::HeightTracer()
 
 void AClimbSystemCharacter::ClimbLedge()
 {
-	if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-		IClimbInterface::Execute_CharacterClimbLedge(MyCharacterMesh->GetAnimInstance(), true);
+	if (UAnimInstance* AnimListener = GetClimbAnimListener())
+		IClimbInterface::Execute_CharacterClimbLedge(AnimListener, true);
 
 	GetCharacterMovement()->SetMovementMode(MOVE_Flying);
+
+	if (bCharacterIsHanging)
+		RecordClimbEvent(EClimbTelemetryEvent::HangEnd, GetWorld()->GetTimeSeconds() - HangStartTime);
+
 	bIsClimbingLedge	= true;
 	bCharacterIsHanging = false;
+
+	ResetLedgePath();
+
+	if (bMeshlessClimb)
+		SimulateClimbStep(EClimbSimulatedStep::ClimbLedge, SimulationTimings.ClimbLedgeTime);
 }
 
 void AClimbSystemCharacter::ExitClimb()
 {
+	bClimbTraversalActive = false;
+
 	if (bCharacterIsHanging)
 	{
 		GetCharacterMovement()->SetMovementMode(MOVE_Walking);
 
-		if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-			IClimbInterface::Execute_CharacterCanGrab(MyCharacterMesh->GetAnimInstance(), false);
+		if (UAnimInstance* AnimListener = GetClimbAnimListener())
+			IClimbInterface::Execute_CharacterCanGrab(AnimListener, false);
 
+		RecordClimbEvent(EClimbTelemetryEvent::HangEnd, GetWorld()->GetTimeSeconds() - HangStartTime);
 		bCharacterIsHanging = false;
+
+		ResetLedgePath();
 	}
 }
 
 void AClimbSystemCharacter::LedgeMovementFinished()
 {
+	LLM_SCOPE_CLIMB();
+
+	bGrabSnapping = false;
 	GetCharacterMovement()->StopMovementImmediately();
+
+	if (bClimbTraversalActive)
+		AdvanceClimbTraversal();
 }
 
 void AClimbSystemCharacter::GrabLedge()
 {
+	ClimbCore::FGrabInput GrabInput;
+	GrabInput.WallLocation	= ClimbCore::ToCore(WallLocation);
+	GrabInput.WallNormal	= ClimbCore::ToCore(WallNormal);
+	GrabInput.LedgeHeight	= WallHeightLocation.Z;
+
+	//Hanging on the ledge path, the grab holds the character where the shimmy left it instead of pulling it back.
+	if (IsFollowingLedgePath())
+	{
+		const FClimbLedgePoint Point = LedgePath.Sample(LedgePathDistance);
+
+		GrabInput.WallLocation	= ClimbCore::ToCore(Point.WallLocation);
+		GrabInput.WallNormal	= ClimbCore::ToCore(Point.WallNormal);
+		GrabInput.LedgeHeight	= Point.LedgeHeight;
+	}
+
+	const ClimbCore::FGrabTarget GrabTarget = ClimbCore::ComputeGrabTarget(GrabInput);
+	const FVector TargetLocation			= ClimbCore::ToEngine(GrabTarget.Location);
+	const FRotator TargetRotation			= ClimbCore::ToEngine(GrabTarget.Rotation);
+
+	//The height probe grabs every frame the character hangs. A snap already on its way to this target is left to finish,
+	//moving it again with the same UUID would restart the interpolation and LedgeMovementFinished would never run.
+	if (bGrabSnapping)
+	{
+		if (TargetLocation.Equals(GrabSnapLocation, ClimbCore::Rules::GrabSnapTolerance) &&
+			TargetRotation.Equals(GrabSnapRotation, ClimbCore::Rules::GrabSnapTolerance))
+			return;
+	}
+
+	//Once the capsule sits on the target there is nothing to snap, so it is placed there instead of starting a latent action each frame.
+	else if (GetActorLocation().Equals(TargetLocation, ClimbCore::Rules::GrabSnapTolerance) &&
+			 GetActorRotation().Equals(TargetRotation, ClimbCore::Rules::GrabSnapTolerance))
+	{
+		SetActorLocationAndRotation(TargetLocation, TargetRotation);
+		LedgeMovementFinished();
+		return;
+	}
+
+	//A new snap, or a snap whose ledge moved. The running one is retargeted from where the capsule is now.
+	if (!bGrabSnapping)
+		GrabSnapStartTime = GetWorld()->GetTimeSeconds();
+
+	bGrabSnapping		= true;
+	GrabSnapLocation	= TargetLocation;
+	GrabSnapRotation	= TargetRotation;
+
 	FLatentActionInfo LatentInfo;
 	LatentInfo.CallbackTarget		= this;
-	LatentInfo.ExecutionFunction	= FName("LedgeMovementFinished");
+	LatentInfo.ExecutionFunction	= NAME_LedgeMovementFinished;
 	LatentInfo.Linkage				= 0;
-	LatentInfo.UUID					= GiveMeAnUUIDNumber();
-
-	const FVector WallNormalMultiplied = WallNormal * FVector(22.0f, 22.0f, 22.0f);
-	const FVector TargetRelativeLocation(WallNormalMultiplied.X + WallLocation.X, WallNormalMultiplied.Y + WallLocation.Y, WallHeightLocation.Z - 120.0f);
+	LatentInfo.UUID					= GrabSnapUUID;
 
-	const FRotator TempRotation				= UKismetMathLibrary::Conv_VectorToRotator(WallNormal);
-	const FRotator TargetRelativoRotation	= UKismetMathLibrary::MakeRotator (TempRotation.Roll, TempRotation.Pitch,TempRotation.Yaw - 180.0f);
-
-	UKismetSystemLibrary::MoveComponentTo(GetCapsuleComponent(), TargetRelativeLocation,
-	TargetRelativoRotation, false, false, 0.13f, false, EMoveComponentAction::Move, LatentInfo);
+	UKismetSystemLibrary::MoveComponentTo(GetCapsuleComponent(), TargetLocation, TargetRotation, false, false,
+	FClimbProbeSettings::Get().GrabSnapTime, false, EMoveComponentAction::Move, LatentInfo);
 }
 
 void AClimbSystemCharacter::CharacterClimbLedge_Implementation(bool bCharacterIsClimbing)
 {
 	bIsClimbingLedge = bCharacterIsClimbing;
 	GetCharacterMovement()->SetMovementMode(MOVE_Walking);
+
+	//Every climb traversal ends on top of its last ledge.
+	if (!bCharacterIsClimbing)
+		bClimbTraversalActive = false;
 }
 
 #pragma endregion
@@ -329,11 +1328,25 @@ void AClimbSystemCharacter::MoveSides()
 {
 	if (bCharacterIsHanging)
 	{
-		RightLeftTracer(false);
-		RightLeftTracer(true);
+		if (!LedgePath.IsValid() && !bLedgePathFailed && !bIsJumping && !bPendingGrabLedge && !bGrabSnapping)
+			ExtractLedgePath();
+
+		//Following the ledge path only probes once per step travelled, the side probes run every frame.
+		if (LedgePath.IsValid())
+		{
+			bCanMoveLeft	= EnsureLedgePath(false);
+			bCanMoveRight	= EnsureLedgePath(true);
+		}
+
+		else
+		{
+			RightLeftTracer(false);
+			RightLeftTracer(true);
+		}
 	}
 
-	MoveCharacterOnTheSides(bCharacterIsHanging);
+	//The shimmy waits for the grab snap and the transition in flight to land. Moving the capsule under either would throw it off.
+	MoveCharacterOnTheSides(bCharacterIsHanging && !bGrabSnapping && !IsClimbTransitionInFlight());
 }
 
 void AClimbSystemCharacter::RightLeftTracer(const bool& bRight)
@@ -341,10 +1354,7 @@ void AClimbSystemCharacter::RightLeftTracer(const bool& bRight)
 	if (bRight)
 	{
 		FHitResult HitResult;
-		const FCollisionShape MyCapsule = FCollisionShape::MakeCapsule(20.0f, 60.0f);
-
-		const bool bOnHit =	GetWorld()->SweepSingleByChannel(HitResult, RightArrow->GetComponentLocation(),
-							RightArrow->GetComponentLocation(), FQuat::Identity, ECC_GameTraceChannel1, MyCapsule);
+		const bool bOnHit = ClimbProbe(EClimbProbe::MoveRight, HitResult);
 
 		bCanMoveRight = bOnHit ? true : false;
 	}
@@ -352,10 +1362,7 @@ void AClimbSystemCharacter::RightLeftTracer(const bool& bRight)
 	else
 	{
 		FHitResult HitResult;
-		const FCollisionShape MyCapsule = FCollisionShape::MakeCapsule(20.0f, 60.0f);
-
-		const bool bOnHit =	GetWorld()->SweepSingleByChannel(HitResult, LeftArrow->GetComponentLocation(),
-							LeftArrow->GetComponentLocation(), FQuat::Identity, ECC_GameTraceChannel1, MyCapsule);
+		const bool bOnHit = ClimbProbe(EClimbProbe::MoveLeft, HitResult);
 
 		bCanMoveLeft = bOnHit ? true : false;
 	}
@@ -367,7 +1374,9 @@ void AClimbSystemCharacter::MoveCharacterOnTheSides(const bool& bMoving)
 
 	if (bMoving)
 	{
-		IClimbInterface::Execute_MoveLeftRight(MyCharacterMesh->GetAnimInstance(), GetInputAxisValue("MoveRight"));
+		if (UAnimInstance* AnimListener = GetClimbAnimListener())
+			IClimbInterface::Execute_MoveLeftRight(AnimListener, GetClimbMoveRightInput());
+
 		MoveInLedge();
 	}
 	
@@ -380,37 +1389,151 @@ void AClimbSystemCharacter::MoveCharacterOnTheSides(const bool& bMoving)
 
 void AClimbSystemCharacter::MoveInLedge()
 {
-	if (bCanMoveRight && GetInputAxisValue("MoveRight") > 0)
+	if (bCanMoveRight && GetClimbMoveRightInput() > 0)
 	{
-		const FVector TargetLocation	=	GetActorLocation() + (UKismetMathLibrary::GetRightVector(GetActorRotation()) * 20.0f);	
-		const FVector InterpVector		=	UKismetMathLibrary::VInterpTo(GetActorLocation(), TargetLocation, 
-											UGameplayStatics::GetWorldDeltaSeconds(GetWorld()), moveSidesSpeed);
+		if (LedgePath.IsValid())
+			MoveAlongLedgePath(true);
+
+		else
+		{
+			const FVector TargetLocation	=	GetActorLocation() + (UKismetMathLibrary::GetRightVector(GetActorRotation()) * 20.0f);	
+			const FVector InterpVector		=	UKismetMathLibrary::VInterpTo(GetActorLocation(), TargetLocation, 
+												UGameplayStatics::GetWorldDeltaSeconds(GetWorld()), FClimbProbeSettings::Get().MoveSidesSpeed);
 		
-		SetActorLocation(InterpVector);
+			SetActorLocation(InterpVector);
+		}
 		
 		bMovingRight	= true;
 		bMovingLeft		= false;
 	}
 
-	else if (bCanMoveLeft && GetInputAxisValue("MoveRight") < 0)
+	else if (bCanMoveLeft && GetClimbMoveRightInput() < 0)
 	{
-		const FVector TargetLocation	=	GetActorLocation() + (UKismetMathLibrary::GetRightVector(GetActorRotation()) * -20.0f);
-		const FVector InterpVector		=	UKismetMathLibrary::VInterpTo(GetActorLocation(), TargetLocation,
-											UGameplayStatics::GetWorldDeltaSeconds(GetWorld()), moveSidesSpeed);
+		if (LedgePath.IsValid())
+			MoveAlongLedgePath(false);
 
-		SetActorLocation(InterpVector);
+		else
+		{
+			const FVector TargetLocation	=	GetActorLocation() + (UKismetMathLibrary::GetRightVector(GetActorRotation()) * -20.0f);
+			const FVector InterpVector		=	UKismetMathLibrary::VInterpTo(GetActorLocation(), TargetLocation,
+												UGameplayStatics::GetWorldDeltaSeconds(GetWorld()), FClimbProbeSettings::Get().MoveSidesSpeed);
+
+			SetActorLocation(InterpVector);
+		}
 
 		bMovingRight	= false;
 		bMovingLeft		= true;
 	}
 
-	else if (GetInputAxisValue("MoveRight") == 0)
+	else if (GetClimbMoveRightInput() == 0)
 	{
 		bMovingRight	= false;
 		bMovingLeft		= false;
 	}
 }
 
+void AClimbSystemCharacter::ExtractLedgePath()
+{
+	const FVector Normal = WallNormal.GetSafeNormal2D();
+
+	//Nothing to follow on a wall without a horizontal normal, the side probes take over until the next grab.
+	if (Normal.IsNearlyZero())
+	{
+		bLedgePathFailed = true;
+		return;
+	}
+
+	LedgePath.Reset(WallLocation, Normal, WallHeightLocation.Z);
+	LedgePathDistance = 0.0f;
+}
+
+void AClimbSystemCharacter::ResetLedgePath()
+{
+	LedgePath.Invalidate();
+	bLedgePathFailed = false;
+}
+
+bool AClimbSystemCharacter::ExtendLedgePath(bool bRight)
+{
+	namespace Rules = ClimbCore::Rules;
+
+	const FClimbLedgePoint& End = LedgePath.GetEnd(bRight);
+	const FVector SideVector	= FVector::CrossProduct(End.WallNormal, FVector::UpVector) * (bRight ? 1.0f : -1.0f);
+
+	FVector Candidate	= End.WallLocation + SideVector * Rules::LedgePathStep;
+	Candidate.Z			= End.LedgeHeight - Rules::LedgePathTopRise;
+
+	//Wall probe along the last normal, just under the ledge.
+	FHitResult WallHit;
+	if (!LedgePathProbe(Candidate + End.WallNormal * Rules::LedgePathWallReach, Candidate - End.WallNormal * Rules::LedgePathWallReach, WallHit) || WallHit.bStartPenetrating)
+		return false;
+
+	const FVector Normal = WallHit.Normal.GetSafeNormal2D();
+	if (FVector::DotProduct(Normal, End.WallNormal) < Rules::LedgePathMinBendCos)
+		return false;
+
+	//Top probe a little behind the new wall point, from above the ledge down.
+	const FVector TopPoint = WallHit.ImpactPoint - Normal * Rules::LedgePathTopInset;
+
+	FHitResult TopHit;
+	if (!LedgePathProbe(FVector(TopPoint.X, TopPoint.Y, End.LedgeHeight + Rules::LedgePathTopRise),
+						FVector(TopPoint.X, TopPoint.Y, End.LedgeHeight - Rules::LedgePathTopRise), TopHit) || TopHit.bStartPenetrating)
+		return false;
+
+	if (FMath::Abs(TopHit.Location.Z - End.LedgeHeight) > Rules::LedgePathMaxStepHeight)
+		return false;
+
+	LedgePath.Extend(bRight, WallHit.Location, Normal, TopHit.Location.Z);
+	return true;
+}
+
+bool AClimbSystemCharacter::EnsureLedgePath(bool bRight)
+{
+	const float Reach		= LedgePathDistance + (bRight ? ClimbCore::Rules::LedgePathStep : -ClimbCore::Rules::LedgePathStep);
+	bool& bEndReached		= bRight ? LedgePath.bRightEndReached : LedgePath.bLeftEndReached;
+
+	while (!bEndReached && (bRight ? LedgePath.GetMaxDistance() < Reach : LedgePath.GetMinDistance() > Reach))
+	{
+		if (!ExtendLedgePath(bRight))
+			bEndReached = true;
+	}
+
+	return bRight ? LedgePath.GetMaxDistance() > LedgePathDistance + KINDA_SMALL_NUMBER : LedgePath.GetMinDistance() < LedgePathDistance - KINDA_SMALL_NUMBER;
+}
+
+void AClimbSystemCharacter::MoveAlongLedgePath(bool bRight)
+{
+	//Same distance per frame the straight shimmy covers with VInterpTo towards a point 20 units away.
+	const float Step	= 20.0f * FMath::Clamp(GetWorld()->GetDeltaSeconds() * FClimbProbeSettings::Get().MoveSidesSpeed, 0.0f, 1.0f);
+	LedgePathDistance	= FMath::Clamp(LedgePathDistance + (bRight ? Step : -Step), LedgePath.GetMinDistance(), LedgePath.GetMaxDistance());
+
+	const FClimbLedgePoint Point = LedgePath.Sample(LedgePathDistance);
+
+	ClimbCore::FGrabInput GrabInput;
+	GrabInput.WallLocation	= ClimbCore::ToCore(Point.WallLocation);
+	GrabInput.WallNormal	= ClimbCore::ToCore(Point.WallNormal);
+	GrabInput.LedgeHeight	= Point.LedgeHeight;
+
+	const ClimbCore::FGrabTarget GrabTarget = ClimbCore::ComputeGrabTarget(GrabInput);
+	SetActorLocationAndRotation(ClimbCore::ToEngine(GrabTarget.Location), ClimbCore::ToEngine(GrabTarget.Rotation));
+
+	WallLocation			= Point.WallLocation;
+	WallNormal				= Point.WallNormal;
+	WallHeightLocation.Z	= Point.LedgeHeight;
+
+	LedgePath.Trim(LedgePathDistance, ClimbCore::Rules::LedgePathKeepBehind);
+}
+
+bool AClimbSystemCharacter::LedgePathProbe(const FVector& Start, const FVector& End, FHitResult& OutHit) const
+{
+	const FClimbProbeSettings& Settings = FClimbProbeSettings::Get();
+	const FCollisionShape ProbeShape	= Settings.bSimpleShapes ? FCollisionShape() : FCollisionShape::MakeSphere(Settings.ProbeSphereRadius);
+
+	INC_DWORD_STAT(STAT_ClimbSceneQueries);
+
+	return GetWorld()->SweepSingleByChannel(OutHit, Start, End, FQuat::Identity, ECC_GameTraceChannel1, ProbeShape, LedgePathQueryParams);
+}
+
 #pragma endregion
 
 #pragma region Jump To the Side Walls
@@ -419,68 +1542,43 @@ void AClimbSystemCharacter::CheckForJumpOnTheSides()
 {
 	if (bCharacterIsHanging)
 	{
-		if (bCanMoveLeft)
-		{
-			bCanJumpLeft = false;
-			bCanTurnLeft = false;
-		}
-		else
+		bool bLedgeHit	= false;
+		bool bCornerHit	= false;
+
+		if (!bCanMoveLeft)
 		{
-			JumpRightLeftTracer(false);
+			bLedgeHit = JumpRightLeftTracer(false);
 
-			if (bCanJumpLeft)
-				bCanTurnLeft = false;
-			else
-				TurnCornerRightLeftTracer(false);
+			//With the corner probe off there is nothing telling it is safe to turn, so don't.
+			if (!bLedgeHit)
+				bCornerHit = IsClimbProbeActive(EClimbProbe::CornerLeft) ? TurnCornerRightLeftTracer(false) : true;
 		}
 
-		if (bCanMoveRight)
-		{
-			bCanJumpRight = false;
-			bCanTurnRight = false;
-		}
-		else
+		const ClimbCore::FSideOptions LeftOptions = ClimbCore::EvaluateSide(bCanMoveLeft, bLedgeHit, bCornerHit);
+		bCanJumpLeft	= LeftOptions.bCanJump;
+		bCanTurnLeft	= LeftOptions.bCanTurn;
+
+		bLedgeHit	= false;
+		bCornerHit	= false;
+
+		if (!bCanMoveRight)
 		{
-			JumpRightLeftTracer(true);
+			bLedgeHit = JumpRightLeftTracer(true);
 
-			if (bCanJumpRight)
-				bCanTurnRight = false;
-			else
-				TurnCornerRightLeftTracer(true);
+			if (!bLedgeHit)
+				bCornerHit = IsClimbProbeActive(EClimbProbe::CornerRight) ? TurnCornerRightLeftTracer(true) : true;
 		}
-	}
 
+		const ClimbCore::FSideOptions RightOptions = ClimbCore::EvaluateSide(bCanMoveRight, bLedgeHit, bCornerHit);
+		bCanJumpRight	= RightOptions.bCanJump;
+		bCanTurnRight	= RightOptions.bCanTurn;
+	}
 }
 
-void AClimbSystemCharacter::JumpRightLeftTracer(const bool& bRight)
+bool AClimbSystemCharacter::JumpRightLeftTracer(const bool& bRight)
 {
-	if (bRight)
-	{
-		FHitResult HitResult;
-		const FCollisionShape MyCapsule = FCollisionShape::MakeCapsule(25.0f, 60.0f);
-
-		const bool bOnHit =	GetWorld()->SweepSingleByChannel(HitResult, RightLedge->GetComponentLocation(),
-							RightLedge->GetComponentLocation(), FQuat::Identity, ECC_GameTraceChannel1, MyCapsule);
-
-		if (bOnHit)
-			bCanJumpRight = bCanMoveRight ? false : true;		
-		else
-			bCanJumpRight = false;
-	}
-	
-	else
-	{
-		FHitResult HitResult;
-		const FCollisionShape MyCapsule = FCollisionShape::MakeCapsule(25.0f, 60.0f);
-
-		bool bOnHit =	GetWorld()->SweepSingleByChannel(HitResult, LeftLedge->GetComponentLocation(),
-						LeftLedge->GetComponentLocation(), FQuat::Identity, ECC_GameTraceChannel1, MyCapsule);
-
-		if (bOnHit)
-			bCanJumpLeft = bCanMoveLeft ? false : true;
-		else
-			bCanJumpLeft = false;
-	}
+	FHitResult HitResult;
+	return ClimbProbe(bRight ? EClimbProbe::JumpRight : EClimbProbe::JumpLeft, HitResult);
 }
 
 void AClimbSystemCharacter::JumpRight_Implementation(bool bJumpRight)
@@ -488,6 +1586,8 @@ void AClimbSystemCharacter::JumpRight_Implementation(bool bJumpRight)
 	bIsJumping = bJumpRight;
 	GetCharacterMovement()->StopMovementImmediately();
 	bIsJumping = false;
+
+	FinishPendingClimbTransitions();
 }
 
 void AClimbSystemCharacter::JumpLeft_Implementation(bool bJumpLeft)
@@ -495,96 +1595,54 @@ void AClimbSystemCharacter::JumpLeft_Implementation(bool bJumpLeft)
 	bIsJumping = bJumpLeft;
 	GetCharacterMovement()->StopMovementImmediately();
 	bIsJumping = false;
+
+	FinishPendingClimbTransitions();
 }
 
 void AClimbSystemCharacter::JumpRightLeftLedge(const bool& bRight)
 {
-	if (bRight)
-	{
-		if (GetInputAxisValue("MoveRight") > 0 && !bIsJumping)
-		{
-			GetCharacterMovement()->SetMovementMode(MOVE_Flying);
-
-			if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-				IClimbInterface::Execute_JumpRight(MyCharacterMesh->GetAnimInstance(), true);
+	const float MoveRightInput = GetClimbMoveRightInput();
 
-			bIsJumping				= true;
-			bCharacterIsHanging		= true;
+	if ((bRight ? MoveRightInput > 0 : MoveRightInput < 0) && !bIsJumping)
+		StartSideJump(bRight);
+}
 
-			FLatentActionInfo LatentInfo;
-			LatentInfo.CallbackTarget		= this;
-			LatentInfo.ExecutionFunction	= FName("GrabLedge");
-			LatentInfo.Linkage				= 0;
-			LatentInfo.UUID					= GiveMeAnUUIDNumber();
+void AClimbSystemCharacter::StartSideJump(bool bRight)
+{
+	GetCharacterMovement()->SetMovementMode(MOVE_Flying);
 
-			UKismetSystemLibrary::Delay(GetWorld(), 0.8f, LatentInfo);
-		}
-	}
-	
-	else
+	if (UAnimInstance* AnimListener = GetClimbAnimListener())
 	{
-		if (GetInputAxisValue("MoveRight") < 0 && !bIsJumping)
-		{
-			GetCharacterMovement()->SetMovementMode(MOVE_Flying);
-
-			if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-				IClimbInterface::Execute_JumpLeft(MyCharacterMesh->GetAnimInstance(), true);
+		if (bRight)
+			IClimbInterface::Execute_JumpRight(AnimListener, true);
+		else
+			IClimbInterface::Execute_JumpLeft(AnimListener, true);
+	}
 
-			bIsJumping				= true;
-			bCharacterIsHanging		= true;
+	bIsJumping				= true;
+	bCharacterIsHanging		= true;
+	bPendingGrabLedge		= true;
+	ClimbTransitionMontage	= nullptr;
+	ActiveTransition		= EClimbTransition::SideJump;
+	TransitionStartTime		= GetWorld()->GetTimeSeconds();
 
-			FLatentActionInfo LatentInfo;
-			LatentInfo.CallbackTarget		= this;
-			LatentInfo.ExecutionFunction	= FName("GrabLedge");
-			LatentInfo.Linkage				= 0;
-			LatentInfo.UUID					= GiveMeAnUUIDNumber();
+	RecordClimbEvent(EClimbTelemetryEvent::SideJumpStart);
+	ResetLedgePath();
 
-			UKismetSystemLibrary::Delay(GetWorld(), 0.8f, LatentInfo);
-		}
-	}
+	if (bMeshlessClimb)
+		SimulateClimbStep(bRight ? EClimbSimulatedStep::SideJumpRight : EClimbSimulatedStep::SideJumpLeft, SimulationTimings.SideJumpTime);
 }
 
 #pragma endregion
 
 #pragma region Turn Around Corner
 
-void AClimbSystemCharacter::TurnCornerRightLeftTracer(const bool& bRight)
+bool AClimbSystemCharacter::TurnCornerRightLeftTracer(const bool& bRight)
 {
-	if (bRight)
-	{
-		GetCharacterMovement()->StopMovementImmediately();
-
-		FHitResult HitResult;
-
-		const FVector StartVector	= UKismetMathLibrary::MakeVector(RightArrow->GetComponentLocation().X,
-									  RightArrow->GetComponentLocation().Y, RightArrow->GetComponentLocation().Z + 60.0f);
-		const FVector EndVector		= StartVector + (RightArrow->GetForwardVector() * 70.0f);
-
-		const FCollisionShape MySphere = FCollisionShape::MakeSphere(20.0f);
-
-		const bool bOnHit = GetWorld()->SweepSingleByChannel(HitResult,StartVector, EndVector, 
-							FQuat::Identity, ECC_GameTraceChannel1, MySphere);
-
-		bCanTurnRight = bOnHit ? false : true;
-	}
-	
-	else
-	{
-		GetCharacterMovement()->StopMovementImmediately();
-
-		FHitResult HitResult;
-
-		const FVector StartVector	= UKismetMathLibrary::MakeVector(LeftArrow->GetComponentLocation().X,
-									  LeftArrow->GetComponentLocation().Y, LeftArrow->GetComponentLocation().Z + 60.0f);
-		const FVector EndVector		= StartVector + (LeftArrow->GetForwardVector() * 70.0f);
-
-		const FCollisionShape MySphere = FCollisionShape::MakeSphere(20.0f);
-
-		const bool bOnHit = GetWorld()->SweepSingleByChannel(HitResult, StartVector, EndVector, 
-							FQuat::Identity,ECC_GameTraceChannel1, MySphere);
+	GetCharacterMovement()->StopMovementImmediately();
 
-		bCanTurnLeft = bOnHit ? false : true;
-	}
+	FHitResult HitResult;
+	return ClimbProbe(bRight ? EClimbProbe::CornerRight : EClimbProbe::CornerLeft, HitResult);
 }
 
 void AClimbSystemCharacter::TurnToWallLeftCorner()
@@ -592,26 +1650,7 @@ void AClimbSystemCharacter::TurnToWallLeftCorner()
 	if (bCharacterIsHanging)
 	{
 		if (!bCanJumpLeft && bCanTurnLeft)
-		{
-			DisableInput(UGameplayStatics::GetPlayerController(GetWorld(), 0));
-			
-			PlayAnimMontage(CornerLeftMontage, 1.0f, NAME_None);
-
-			FLatentActionInfo LatentInfo;
-			LatentInfo.CallbackTarget			= this;
-			LatentInfo.ExecutionFunction		= FName("GrabLedge");
-			LatentInfo.Linkage					= 0;
-			LatentInfo.UUID						= GiveMeAnUUIDNumber();
-
-			FLatentActionInfo LatentInfoInputs;
-			LatentInfoInputs.CallbackTarget		= this;
-			LatentInfoInputs.ExecutionFunction	= FName("EnablePlayerInputs");
-			LatentInfoInputs.Linkage			= 0;
-			LatentInfoInputs.UUID				= GiveMeAnUUIDNumber();
-
-			UKismetSystemLibrary::Delay(GetWorld(), 0.8f, LatentInfo);
-			UKismetSystemLibrary::Delay(GetWorld(), 1.5f, LatentInfoInputs);
-		}
+			TurnCorner(false);
 	}
 }
 
@@ -620,32 +1659,111 @@ void AClimbSystemCharacter::TurnToWallRightCorner()
 	if (bCharacterIsHanging)
 	{
 		if (!bCanJumpRight && bCanTurnRight)
-		{
-			DisableInput(UGameplayStatics::GetPlayerController(GetWorld(), 0));
-			
-			PlayAnimMontage(CornerRightMontage, 1.0f, NAME_None);
-
-			FLatentActionInfo LatentInfo;
-			LatentInfo.CallbackTarget			= this;
-			LatentInfo.ExecutionFunction		= FName("GrabLedge");
-			LatentInfo.Linkage					= 0;
-			LatentInfo.UUID						= GiveMeAnUUIDNumber();
-
-			FLatentActionInfo LatentInfoInputs;
-			LatentInfoInputs.CallbackTarget		= this;
-			LatentInfoInputs.ExecutionFunction	= FName("EnablePlayerInputs");
-			LatentInfoInputs.Linkage			= 0;
-			LatentInfoInputs.UUID				= GiveMeAnUUIDNumber();
-
-			UKismetSystemLibrary::Delay(GetWorld(), 0.8f, LatentInfo);
-			UKismetSystemLibrary::Delay(GetWorld(), 1.5f, LatentInfoInputs);
-		}
+			TurnCorner(true);
+	}
+}
+
+void AClimbSystemCharacter::TurnCorner(bool bRight)
+{
+	DisableInput(UGameplayStatics::GetPlayerController(GetWorld(), 0));
+
+	bClimbInputDisabled		= true;
+	bPendingGrabLedge		= true;
+	bPendingInputEnable		= true;
+	ClimbTransitionMontage	= nullptr;
+	ActiveTransition		= EClimbTransition::CornerTurn;
+	TransitionStartTime		= GetWorld()->GetTimeSeconds();
+	InputLockStartTime		= TransitionStartTime;
+
+	RecordClimbEvent(EClimbTelemetryEvent::CornerTurnStart);
+	ResetLedgePath();
+
+	if (bMeshlessClimb)
+	{
+		SimulateClimbStep(bRight ? EClimbSimulatedStep::CornerRight : EClimbSimulatedStep::CornerLeft, SimulationTimings.CornerGrabTime);
+		SimulateClimbStep(EClimbSimulatedStep::CornerInput, SimulationTimings.CornerInputTime);
+		return;
 	}
+
+	UAnimMontage* CornerMontage = bRight ? CornerRightMontage.Get() : CornerLeftMontage.Get();
+
+	//If the montage can't play there is no notify to wait for, so finish the turn right away.
+	if (PlayAnimMontage(CornerMontage, 1.0f, NAME_None) <= 0.0f)
+		FinishPendingClimbTransitions();
+	else
+		ClimbTransitionMontage = CornerMontage;
 }
 
 void AClimbSystemCharacter::EnablePlayerInputs()
 {
+	bPendingInputEnable = false;
+	bClimbInputDisabled = false;
 	EnableInput(UGameplayStatics::GetPlayerController(GetWorld(), 0));
+
+	//Presses made during the lock run on the notify that ends it.
+	if (ClimbActionBuffer.Num() > 0)
+		ProcessClimbActionBuffer();
+}
+
+#pragma endregion
+
+#pragma region Animation Driven Transitions
+
+void AClimbSystemCharacter::OnClimbMontageNotifyBegin(FName NotifyName, const FBranchingPointNotifyPayload& BranchingPointPayload)
+{
+	LLM_SCOPE_CLIMB();
+
+	if (NotifyName == GrabLedgeNotifyName && bPendingGrabLedge)
+		LandClimbTransition();
+
+	else if (NotifyName == EnableInputNotifyName && bPendingInputEnable)
+		EnablePlayerInputs();
+}
+
+void AClimbSystemCharacter::OnClimbMontageStarted(UAnimMontage* Montage)
+{
+	//The side jump montages are played by the anim blueprint, so this is where they are found.
+	if (!ClimbTransitionMontage && (bPendingGrabLedge || bPendingInputEnable))
+		ClimbTransitionMontage = Montage;
+}
+
+void AClimbSystemCharacter::OnClimbMontageBlendingOut(UAnimMontage* Montage, bool bInterrupted)
+{
+	LLM_SCOPE_CLIMB();
+
+	if (!Montage || Montage != ClimbTransitionMontage)
+		return;
+
+	ClimbTransitionMontage = nullptr;
+
+	//Cut off before its notifies, the transition would never end. It lands on the ledge it was going to, like a restored one.
+	if (bInterrupted && (bPendingGrabLedge || bPendingInputEnable))
+		UE_LOG(LogClimb, Verbose, TEXT("%s: climb transition montage %s interrupted, landing the transition"), *GetName(), *Montage->GetName());
+
+	FinishPendingClimbTransitions();
+}
+
+void AClimbSystemCharacter::FinishPendingClimbTransitions()
+{
+	if (bPendingGrabLedge)
+		LandClimbTransition();
+
+	if (bPendingInputEnable)
+		EnablePlayerInputs();
+}
+
+void AClimbSystemCharacter::LandClimbTransition()
+{
+	bPendingGrabLedge = false;
+
+	if (ActiveTransition == EClimbTransition::SideJump)
+		RecordClimbEvent(EClimbTelemetryEvent::SideJumpLanded);
+	else if (ActiveTransition == EClimbTransition::CornerTurn)
+		RecordClimbEvent(EClimbTelemetryEvent::CornerTurnFinished);
+
+	ActiveTransition = EClimbTransition::None;
+
+	GrabLedge();
 }
 
 #pragma endregion
@@ -655,10 +1773,7 @@ void AClimbSystemCharacter::EnablePlayerInputs()
 void AClimbSystemCharacter::JumpUpTracer()
 {
 	FHitResult HitResult;
-	const FCollisionShape MyCapsule = FCollisionShape::MakeCapsule(20.0f, 100.0f);
-
-	const bool bOnHit =	GetWorld()->SweepSingleByChannel(HitResult, UpArrow->GetComponentLocation(),
-						UpArrow->GetComponentLocation(), FQuat::Identity, ECC_GameTraceChannel1, MyCapsule);
+	const bool bOnHit = ClimbProbe(EClimbProbe::JumpUp, HitResult);
 
 	bCanJumpUp = bOnHit ? true : false;
 }
@@ -669,23 +1784,35 @@ void AClimbSystemCharacter::JumpUp_Implementation(bool bJumpUp)
 	GetCharacterMovement()->StopMovementImmediately();
 	bIsJumping = false;
 	
-	GrabLedge();
+	LandClimbTransition();
 	EnablePlayerInputs();
 }
 
 void AClimbSystemCharacter::JumpUpLedge()
 {
-	if (GetInputAxisValue("MoveRight") == 0 && bCanJumpUp && !bIsJumping)
-	{
-		GetCharacterMovement()->SetMovementMode(MOVE_Flying);
+	if (GetClimbMoveRightInput() == 0 && bCanJumpUp && !bIsJumping)
+		StartJumpUp();
+}
+
+void AClimbSystemCharacter::StartJumpUp()
+{
+	GetCharacterMovement()->SetMovementMode(MOVE_Flying);
 
-		if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-			IClimbInterface::Execute_JumpUp(MyCharacterMesh->GetAnimInstance(), true);
+	if (UAnimInstance* AnimListener = GetClimbAnimListener())
+		IClimbInterface::Execute_JumpUp(AnimListener, true);
 
-		bIsJumping = true;
+	bIsJumping			= true;
+	bClimbInputDisabled = true;
+	ActiveTransition	= EClimbTransition::JumpUp;
+	TransitionStartTime = GetWorld()->GetTimeSeconds();
+	InputLockStartTime	= TransitionStartTime;
 
-		DisableInput(UGameplayStatics::GetPlayerController(GetWorld(), 0));
-	}
+	ResetLedgePath();
+
+	DisableInput(UGameplayStatics::GetPlayerController(GetWorld(), 0));
+
+	if (bMeshlessClimb)
+		SimulateClimbStep(EClimbSimulatedStep::JumpUp, SimulationTimings.JumpUpTime);
 }
 
 #pragma  endregion
@@ -696,16 +1823,16 @@ void AClimbSystemCharacter::CharacterTurnBack()
 {
 	bTurnedBack = true;
 
-	if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-		IClimbInterface::Execute_TurnBack(MyCharacterMesh->GetAnimInstance(), true);
+	if (UAnimInstance* AnimListener = GetClimbAnimListener())
+		IClimbInterface::Execute_TurnBack(AnimListener, true);
 }
 
 void AClimbSystemCharacter::CharacterTurnForward()
 {
 	if (bTurnedBack)
 	{
-		if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-			IClimbInterface::Execute_TurnBack(MyCharacterMesh->GetAnimInstance(), false);
+		if (UAnimInstance* AnimListener = GetClimbAnimListener())
+			IClimbInterface::Execute_TurnBack(AnimListener, false);
 
 		bTurnedBack = false;
 	}
@@ -718,8 +1845,8 @@ void AClimbSystemCharacter::JumpBack()
 	LaunchCharacter(LaunchCharacterVelocity, false, false);
 	ExitClimb();
 
-	if (MyCharacterMesh->GetAnimInstance()->GetClass()->ImplementsInterface(UClimbInterface::StaticClass()))
-	IClimbInterface::Execute_TurnBack(MyCharacterMesh->GetAnimInstance(), false);
+	if (UAnimInstance* AnimListener = GetClimbAnimListener())
+		IClimbInterface::Execute_TurnBack(AnimListener, false);
 
 	bTurnedBack = false;
 
@@ -2,14 +2,51 @@
 
 #include "ClimbSystemGameMode.h"
 #include "ClimbSystemCharacter.h"
-#include "UObject/ConstructorHelpers.h"
+#include "ClimbAssetSubsystem.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/PlayerController.h"
 
 AClimbSystemGameMode::AClimbSystemGameMode()
 {
-	// set default pawn class to our Blueprinted character
-	static ConstructorHelpers::FClassFinder<APawn> PlayerPawnBPClass(TEXT("/Game/ThirdPersonCPP/Blueprints/ThirdPersonCharacter"));
-	if (PlayerPawnBPClass.Class != NULL)
+	// the Blueprinted character is streamed in by InitGame, so the game mode doesn't drag it and its animations in when loaded
+	ClimberPawnClass = TSoftClassPtr<APawn>(FSoftObjectPath(TEXT("/Game/ThirdPersonCPP/Blueprints/ThirdPersonCharacter.ThirdPersonCharacter_C")));
+}
+
+void AClimbSystemGameMode::InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage)
+{
+	Super::InitGame(MapName, Options, ErrorMessage);
+
+	UClimbAssetSubsystem* ClimbAssets = GetGameInstance() ? GetGameInstance()->GetSubsystem<UClimbAssetSubsystem>() : nullptr;
+
+	if (ClimbAssets && !ClimberPawnClass.IsNull())
+		ClimbAssets->RequestClimberClass(ClimberPawnClass, FSimpleDelegate::CreateUObject(this, &AClimbSystemGameMode::OnClimberClassLoaded));
+	else
+		OnClimberClassLoaded();
+}
+
+void AClimbSystemGameMode::HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer)
+{
+	if (!bClimberClassLoaded)
+	{
+		WaitingPlayers.Add(NewPlayer);
+		return;
+	}
+
+	Super::HandleStartingNewPlayer_Implementation(NewPlayer);
+}
+
+void AClimbSystemGameMode::OnClimberClassLoaded()
+{
+	bClimberClassLoaded = true;
+
+	if (bClimberIsDefaultPawn && GetLoadedClimberClass())
+		DefaultPawnClass = GetLoadedClimberClass();
+
+	const TArray<APlayerController*> Players = MoveTemp(WaitingPlayers);
+
+	for (APlayerController* Player : Players)
 	{
-		DefaultPawnClass = PlayerPawnBPClass.Class;
+		if (IsValid(Player))
+			Super::HandleStartingNewPlayer_Implementation(Player);
 	}
 }
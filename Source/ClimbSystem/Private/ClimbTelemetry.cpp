@@ -0,0 +1,220 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbTelemetry.h"
+#include "ClimbSystem.h"
+#include "HAL/FileManager.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/Runnable.h"
+#include "HAL/RunnableThread.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/DateTime.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeLock.h"
+
+DECLARE_CYCLE_STAT(TEXT("Climb Telemetry Flush"),				STAT_ClimbTelemetryFlush,	STATGROUP_Climb);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Climb Telemetry Written"),	STAT_ClimbTelemetryWritten,	STATGROUP_Climb);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Climb Telemetry Dropped"),	STAT_ClimbTelemetryDropped,	STATGROUP_Climb);
+
+static TAutoConsoleVariable<int32> CVarClimbTelemetry(
+	TEXT("climb.Telemetry"),
+	0,
+	TEXT("Records climb events to Saved/Telemetry. Read when a climber begins play."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<int32> CVarClimbTelemetryQueueSize(
+	TEXT("climb.Telemetry.QueueSize"),
+	256,
+	TEXT("Events each climber can buffer between two flushes. Extra events are dropped and counted."),
+	ECVF_Default);
+
+static TAutoConsoleVariable<float> CVarClimbTelemetryFlushInterval(
+	TEXT("climb.Telemetry.FlushInterval"),
+	0.25f,
+	TEXT("Seconds between two flushes of the climb telemetry thread."),
+	ECVF_Default);
+
+static const TCHAR* ClimbTelemetryEventNames[] =
+{
+	TEXT("LedgeContact"),
+	TEXT("Grab"),
+	TEXT("MissedGrab"),
+	TEXT("HangStart"),
+	TEXT("HangEnd"),
+	TEXT("SideJumpStart"),
+	TEXT("SideJumpLanded"),
+	TEXT("CornerTurnStart"),
+	TEXT("CornerTurnFinished"),
+	TEXT("InputRejected"),
+};
+
+static_assert(ARRAY_COUNT(ClimbTelemetryEventNames) == (int32)EClimbTelemetryEvent::Count, "Every climb telemetry event needs a name");
+
+FClimbTelemetryChannel::FClimbTelemetryChannel(const FString& InClimberName, uint32 Capacity)
+	: ClimberName(InClimberName)
+	, Queue(FMath::Max(Capacity, 2u))
+{
+}
+
+/* Background thread that drains every channel into one CSV file*/
+class FClimbTelemetryWriter : public FRunnable
+{
+public:
+
+	static FClimbTelemetryWriter& Get()
+	{
+		static FClimbTelemetryWriter Writer;
+		return Writer;
+	}
+
+	FClimbTelemetryChannelPtr OpenChannel(const FString& ClimberName)
+	{
+		FScopeLock Lock(&ChannelsLock);
+
+		if (!bStarted)
+			Start();
+
+		if (!Thread)
+			return nullptr;
+
+		FClimbTelemetryChannelPtr Channel = MakeShared<FClimbTelemetryChannel, ESPMode::ThreadSafe>(ClimberName, CVarClimbTelemetryQueueSize.GetValueOnGameThread());
+		Channels.Add(Channel);
+
+		return Channel;
+	}
+
+	virtual uint32 Run() override
+	{
+		while (!bStopping)
+		{
+			Flush();
+			FPlatformProcess::Sleep(FMath::Max(CVarClimbTelemetryFlushInterval.GetValueOnAnyThread(), 0.01f));
+		}
+
+		Flush();
+		return 0;
+	}
+
+	virtual void Stop() override
+	{
+		bStopping = true;
+	}
+
+private:
+
+	FCriticalSection ChannelsLock;
+	TArray<FClimbTelemetryChannelPtr> Channels;
+	TArray<FClimbTelemetryChannelPtr> FlushChannels;
+	FRunnableThread* Thread = nullptr;
+	FArchive* File			= nullptr;
+	FThreadSafeBool bStopping;
+	bool bStarted			= false;
+	FString Lines;
+
+	void Start()
+	{
+		bStarted = true;
+
+		const FString FilePath = FPaths::ProjectSavedDir() / TEXT("Telemetry") / FString::Printf(TEXT("Climb_%s.csv"), *FDateTime::Now().ToString());
+
+		File = IFileManager::Get().CreateFileWriter(*FilePath, FILEWRITE_AllowRead);
+		if (!File)
+		{
+			UE_LOG(LogClimb, Warning, TEXT("Climb telemetry: could not open %s"), *FilePath);
+			return;
+		}
+
+		WriteLine(TEXT("Time,Climber,Event,Value\n"));
+
+		Thread = FRunnableThread::Create(this, TEXT("ClimbTelemetryWriter"), 0, TPri_BelowNormal);
+		FCoreDelegates::OnPreExit.AddRaw(this, &FClimbTelemetryWriter::Shutdown);
+
+		UE_LOG(LogClimb, Log, TEXT("Climb telemetry: writing to %s"), *FilePath);
+	}
+
+	void Shutdown()
+	{
+		if (Thread)
+		{
+			Thread->Kill(true);
+			delete Thread;
+			Thread = nullptr;
+		}
+
+		delete File;
+		File = nullptr;
+	}
+
+	void Flush()
+	{
+		SCOPE_CYCLE_COUNTER(STAT_ClimbTelemetryFlush);
+
+		{
+			FScopeLock Lock(&ChannelsLock);
+			FlushChannels = Channels;
+		}
+
+		int32 Written = 0;
+		int32 Dropped = 0;
+
+		for (const FClimbTelemetryChannelPtr& Channel : FlushChannels)
+		{
+			//Closed is read first, so nothing recorded before closing can be missed.
+			const bool bWasClosed = Channel->bClosed;
+
+			FClimbTelemetryRecord Record;
+			while (Channel->Queue.Dequeue(Record))
+			{
+				Lines += FString::Printf(TEXT("%.4f,%s,%s,%.4f\n"), Record.Time, *Channel->ClimberName, ClimbTelemetryEventNames[(int32)Record.Event], Record.Value);
+				Written++;
+			}
+
+			Dropped += Channel->DroppedRecords.Reset();
+
+			if (bWasClosed)
+			{
+				FScopeLock Lock(&ChannelsLock);
+				Channels.Remove(Channel);
+			}
+		}
+
+		FlushChannels.Reset();
+
+		if (!Lines.IsEmpty())
+		{
+			WriteLine(Lines);
+			Lines.Reset();
+			File->Flush();
+		}
+
+		INC_DWORD_STAT_BY(STAT_ClimbTelemetryWritten, Written);
+		INC_DWORD_STAT_BY(STAT_ClimbTelemetryDropped, Dropped);
+
+		if (Dropped > 0)
+			UE_LOG(LogClimb, Warning, TEXT("Climb telemetry: %d events dropped, raise climb.Telemetry.QueueSize"), Dropped);
+	}
+
+	void WriteLine(const FString& Text)
+	{
+		FTCHARToUTF8 Utf8Text(*Text);
+		File->Serialize((void*)Utf8Text.Get(), Utf8Text.Length());
+	}
+};
+
+bool FClimbTelemetry::IsEnabled()
+{
+	return CVarClimbTelemetry.GetValueOnGameThread() != 0;
+}
+
+FClimbTelemetryChannelPtr FClimbTelemetry::OpenChannel(const FString& ClimberName)
+{
+	return FClimbTelemetryWriter::Get().OpenChannel(ClimberName);
+}
+
+void FClimbTelemetry::CloseChannel(const FClimbTelemetryChannelPtr& Channel)
+{
+	if (Channel.IsValid())
+		Channel->bClosed = true;
+}
@@ -0,0 +1,20 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbableVolume.h"
+#include "Components/BrushComponent.h"
+#include "Engine/CollisionProfile.h"
+
+AClimbableVolume::AClimbableVolume()
+{
+	GetBrushComponent()->SetCollisionProfileName(UCollisionProfile::CustomCollisionProfileName);
+	GetBrushComponent()->SetCollisionEnabled(ECollisionEnabled::QueryOnly);
+	GetBrushComponent()->SetCollisionResponseToAllChannels(ECR_Ignore);
+	GetBrushComponent()->SetCollisionResponseToChannel(ECC_Pawn, ECR_Overlap);
+	GetBrushComponent()->SetGenerateOverlapEvents(true);
+
+	bColored	= true;
+	BrushColor	= FColor(255, 160, 40, 255);
+}
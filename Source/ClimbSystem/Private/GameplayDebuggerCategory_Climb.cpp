@@ -0,0 +1,228 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "GameplayDebuggerCategory_Climb.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "ClimbSystemCharacter.h"
+#include "ClimbSettings.h"
+#include "GameFramework/CharacterMovementComponent.h"
+
+static const TCHAR* ClimbProbeNames[] =
+{
+	TEXT("Forward"),
+	TEXT("Height"),
+	TEXT("JumpUp"),
+	TEXT("MoveRight"),
+	TEXT("MoveLeft"),
+	TEXT("JumpRight"),
+	TEXT("JumpLeft"),
+	TEXT("CornerRight"),
+	TEXT("CornerLeft"),
+};
+
+static const TCHAR* ClimbTransitionNames[] =
+{
+	TEXT("None"),
+	TEXT("SideJump"),
+	TEXT("CornerTurn"),
+	TEXT("JumpUp"),
+};
+
+static const TCHAR* ClimbSnapshotFlagNames[] =
+{
+	TEXT("Hanging"),
+	TEXT("TurnedBack"),
+	TEXT("Jumping"),
+	TEXT("ClimbingLedge"),
+	TEXT("PendingGrabLedge"),
+	TEXT("PendingInputEnable"),
+	TEXT("InputDisabled"),
+	TEXT("GrabSnapping"),
+};
+
+FGameplayDebuggerCategory_Climb::FGameplayDebuggerCategory_Climb()
+{
+	static_assert(ARRAY_COUNT(ClimbProbeNames) == (int32)EClimbProbe::Count, "Every climb probe needs a name");
+
+	SetDataPackReplication<FRepData>(&DataPack);
+}
+
+TSharedRef<FGameplayDebuggerCategory> FGameplayDebuggerCategory_Climb::MakeInstance()
+{
+	return MakeShareable(new FGameplayDebuggerCategory_Climb());
+}
+
+void FGameplayDebuggerCategory_Climb::FRepData::Serialize(FArchive& Ar)
+{
+	Ar << ClimberName;
+	Ar << StateDesc;
+	Ar << OptionsDesc;
+	Ar << TransitionDesc;
+
+	int32 NumProbes = Probes.Num();
+	Ar << NumProbes;
+
+	if (Ar.IsLoading())
+		Probes.SetNum(NumProbes);
+
+	for (FProbeStats& Stats : Probes)
+	{
+		Ar << Stats.MicrosecondsPerFrame;
+		Ar << Stats.MaxMicroseconds;
+		Ar << Stats.NumRun;
+		Ar << Stats.NumReused;
+		Ar << Stats.NumHits;
+		Ar << Stats.bActive;
+		Ar << Stats.bLastHit;
+	}
+}
+
+void FGameplayDebuggerCategory_Climb::CollectData(APlayerController* OwnerPC, AActor* DebugActor)
+{
+	DataPack = FRepData();
+
+	const AClimbSystemCharacter* Climber = Cast<AClimbSystemCharacter>(DebugActor);
+	if (!Climber)
+		return;
+
+	DataPack.ClimberName = Climber->GetName();
+
+	FClimbSnapshot Snapshot;
+	Climber->SaveClimbSnapshot(Snapshot);
+
+	for (int32 Flag = 0; Flag < (int32)ARRAY_COUNT(ClimbSnapshotFlagNames); Flag++)
+	{
+		if (Snapshot.Flags & (1 << Flag))
+			DataPack.StateDesc += FString::Printf(TEXT("%s "), ClimbSnapshotFlagNames[Flag]);
+	}
+
+	DataPack.StateDesc += FString::Printf(TEXT("{white}(%s, %s, %s, quality %d%s%s)"), *Climber->GetCharacterMovement()->GetMovementName(),
+		Climber->IsMeshlessClimb() ? TEXT("mesh-less") : TEXT("animated"),
+		Climber->ProbeMode == EClimbProbeMode::BroadPhase ? TEXT("broad phase") : TEXT("per probe"), FClimbProbeSettings::GetQualityTier(),
+		Climber->IsClimbSensingActive() ? TEXT("") : TEXT(", sensing off"), Climber->IsClimbTraversalActive() ? TEXT(", nav link") : TEXT(""));
+
+	DataPack.OptionsDesc = FString::Printf(TEXT("%s%s%s%s%s%s%s"),
+		Climber->bCanMoveLeft	? TEXT("MoveLeft ")		: TEXT(""),
+		Climber->bCanMoveRight	? TEXT("MoveRight ")	: TEXT(""),
+		Climber->bCanJumpLeft	? TEXT("JumpLeft ")		: TEXT(""),
+		Climber->bCanJumpRight	? TEXT("JumpRight ")	: TEXT(""),
+		Climber->bCanJumpUp		? TEXT("JumpUp ")		: TEXT(""),
+		Climber->bCanTurnLeft	? TEXT("TurnLeft ")		: TEXT(""),
+		Climber->bCanTurnRight	? TEXT("TurnRight ")	: TEXT(""));
+
+	DataPack.TransitionDesc = FString::Printf(TEXT("{yellow}%s {white}for %.2f s, grab snap %.2f s, input locked %.2f s, %d buffered actions"),
+		ClimbTransitionNames[(uint8)Snapshot.Transition], Climber->GetPendingTransitionTime(), Climber->GetGrabSnapTime(),
+		Climber->GetClimbInputLockedTime(), Climber->ClimbActionBuffer.Num());
+
+	DataPack.Probes.SetNum((int32)EClimbProbe::Count);
+
+	for (int32 Probe = 0; Probe < (int32)EClimbProbe::Count; Probe++)
+		CollectProbe(*Climber, Probe);
+
+	//Where the probes last put the wall and the ledge.
+	if (Snapshot.HasFlag(FClimbSnapshot::Hanging) || Climber->ProbeResults[(uint8)EClimbProbe::Forward].bHit)
+	{
+		AddShape(FGameplayDebuggerShape::MakePoint(Climber->WallLocation, 6.0f, FColor::Cyan, TEXT("Wall")));
+		AddShape(FGameplayDebuggerShape::MakePoint(Climber->WallHeightLocation, 6.0f, FColor::Magenta, TEXT("Ledge")));
+	}
+}
+
+void FGameplayDebuggerCategory_Climb::CollectProbe(const AClimbSystemCharacter& Climber, int32 Probe)
+{
+	FProbeStats& Stats					= DataPack.Probes[Probe];
+	const FClimbProbeHistory& History	= Climber.ProbeHistory[Probe];
+	const FClimbProbeResult& Result		= Climber.ProbeResults[Probe];
+
+	float TotalMicroseconds = 0.0f;
+
+	for (int32 Frame = 0; Frame < FClimbProbeHistory::NumFrames; Frame++)
+	{
+		const uint8 Outcome = History.Outcomes[Frame];
+
+		if (Outcome == FClimbProbeHistory::Reused)
+			Stats.NumReused++;
+
+		else if (Outcome != FClimbProbeHistory::NotRun)
+			Stats.NumRun++;
+
+		if (Outcome == FClimbProbeHistory::Hit)
+			Stats.NumHits++;
+
+		TotalMicroseconds		+= History.Microseconds[Frame];
+		Stats.MaxMicroseconds	= FMath::Max(Stats.MaxMicroseconds, History.Microseconds[Frame]);
+	}
+
+	Stats.MicrosecondsPerFrame	= TotalMicroseconds / FClimbProbeHistory::NumFrames;
+	Stats.bActive				= Climber.IsClimbProbeActive((EClimbProbe)Probe);
+	Stats.bLastHit				= Result.bValid && Result.bHit;
+
+	FVector Start;
+	FVector End;
+	FCollisionShape Shape;
+	Climber.GetClimbProbeQuery((EClimbProbe)Probe, Start, End, Shape);
+
+	//Drawn where the probe would run now, in the color of its last answer.
+	const FColor Color			= !Stats.bActive ? FColor::Silver : Stats.bLastHit ? FColor::Green : FColor::Red;
+	const FString Description	= ClimbProbeNames[Probe];
+
+	if (Shape.IsCapsule())
+	{
+		AddShape(FGameplayDebuggerShape::MakeCapsule(Start, Shape.GetCapsuleRadius(), Shape.GetCapsuleHalfHeight(), Color, Description));
+		return;
+	}
+
+	const float Radius = Shape.IsSphere() ? Shape.GetSphereRadius() : 2.0f;
+
+	AddShape(FGameplayDebuggerShape::MakeSegment(Start, End, 2.0f, Color, Description));
+	AddShape(FGameplayDebuggerShape::MakePoint(End, Radius, Color));
+
+	//Where the swept shape stopped, and what it touched.
+	if (Stats.bLastHit)
+	{
+		AddShape(FGameplayDebuggerShape::MakePoint(Result.Hit.Location, Radius, FColor::Green));
+		AddShape(FGameplayDebuggerShape::MakePoint(Result.Hit.ImpactPoint, 4.0f, FColor::Yellow));
+	}
+}
+
+void FGameplayDebuggerCategory_Climb::DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext)
+{
+	if (DataPack.ClimberName.IsEmpty())
+	{
+		CanvasContext.Printf(TEXT("{red}The selected actor is not a climber"));
+		return;
+	}
+
+	CanvasContext.Printf(TEXT("Climber: {yellow}%s"), *DataPack.ClimberName);
+	CanvasContext.Printf(TEXT("State: {yellow}%s"), *DataPack.StateDesc);
+	CanvasContext.Printf(TEXT("Can: {yellow}%s"), *DataPack.OptionsDesc);
+	CanvasContext.Printf(TEXT("Transition: %s"), *DataPack.TransitionDesc);
+	CanvasContext.Printf(TEXT("Probes over the last %d frames:"), FClimbProbeHistory::NumFrames);
+
+	int32 CostliestProbe = INDEX_NONE;
+	for (int32 Probe = 0; Probe < DataPack.Probes.Num(); Probe++)
+	{
+		if (CostliestProbe == INDEX_NONE || DataPack.Probes[Probe].MicrosecondsPerFrame > DataPack.Probes[CostliestProbe].MicrosecondsPerFrame)
+			CostliestProbe = Probe;
+	}
+
+	for (int32 Probe = 0; Probe < DataPack.Probes.Num(); Probe++)
+	{
+		const FProbeStats& Stats = DataPack.Probes[Probe];
+
+		//Orange for probes that keep running without ever hitting, red for the one that costs the most.
+		const TCHAR* Color = !Stats.bActive ? TEXT("grey") : Probe == CostliestProbe && Stats.NumRun > 0 ? TEXT("red") :
+			Stats.NumRun > 0 && Stats.NumHits == 0 ? TEXT("orange") : TEXT("white");
+
+		const float HitRate = Stats.NumRun > 0 ? 100.0f * Stats.NumHits / Stats.NumRun : 0.0f;
+
+		CanvasContext.Printf(TEXT("  {%s}%-12s %-4s %6.2f us/frame %6.2f us max %4d run %4d reused %3.0f%% hit"), Color, ClimbProbeNames[Probe],
+			!Stats.bActive ? TEXT("off") : Stats.bLastHit ? TEXT("hit") : TEXT("miss"), Stats.MicrosecondsPerFrame, Stats.MaxMicroseconds,
+			Stats.NumRun, Stats.NumReused, HitRate);
+	}
+}
+
+#endif
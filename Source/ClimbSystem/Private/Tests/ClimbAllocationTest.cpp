@@ -0,0 +1,65 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSteadyFrameAllocationTest, "ClimbSystem.Climb.SteadyFrameAllocations",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/* A climber hanging still or shimmying along a long wall, once its grab has landed, runs whole world frames without
+growing the Climb LLM tag. Every climb entry point runs under that tag, so a frame that keeps memory shows up there*/
+bool FClimbSteadyFrameAllocationTest::RunTest(const FString& Parameters)
+{
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	static const float MoveRightInputs[]		= { 0.0f, 1.0f, -1.0f };
+	static const TCHAR* MoveRightInputNames[]	= { TEXT("hanging"), TEXT("shimmying right"), TEXT("shimmying left") };
+	static const float WarmUpSeconds			= 0.5f;
+	static const float MeasureSeconds			= 5.0f;
+
+	if (!FLowLevelMemTracker::IsEnabled())
+	{
+		AddWarning(TEXT("LLM is off, nothing to measure. Run with -LLM"));
+		return true;
+	}
+
+	FClimbTestWorld TestWorld;
+
+	//Wall face at X 100, top at 300, long enough to shimmy on both ways. The climber starts with its pelvis in grab range.
+	TestWorld.AddWall(FVector(150.0f, 0.0f, 150.0f), FVector(50.0f, 2000.0f, 150.0f));
+	AClimbSystemCharacter* Climber = TestWorld.SpawnClimber(FVector(40.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+
+	if (!TestNotNull(TEXT("Climber spawned"), Climber))
+		return false;
+
+	//The grab snap has to land on its own, or the steady frame is never reached.
+	if (!TestTrue(TEXT("Climber grabs the ledge and its grab snap lands"), TestWorld.TickUntilSettled(Climber)))
+		return false;
+
+	for (int32 Input = 0; Input < (int32)ARRAY_COUNT(MoveRightInputs); Input++)
+	{
+		FClimbSnapshot Snapshot;
+		Climber->SaveClimbSnapshot(Snapshot);
+
+		//Warm up first, so the ledge path and the probe buffers have grown to their steady size.
+		Climber->SetClimbMoveRightInput(MoveRightInputs[Input]);
+		TestWorld.Tick(WarmUpSeconds);
+
+		const int64 Growth = TestWorld.TickMeasuringClimbMemory(MeasureSeconds);
+		TestEqual(FString::Printf(TEXT("Climb memory growth in %.0f s %s"), MeasureSeconds, MoveRightInputNames[Input]), Growth, (int64)0);
+
+		Climber->SetClimbMoveRightInput(0.0f);
+		Climber->RestoreClimbSnapshot(Snapshot);
+		TestWorld.TickUntilSettled(Climber);
+	}
+#else
+	AddWarning(TEXT("LLM is not compiled in, nothing to measure"));
+#endif
+
+	return true;
+}
+
+#endif
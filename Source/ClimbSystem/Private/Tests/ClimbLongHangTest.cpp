@@ -0,0 +1,46 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbTestWorld.h"
+#include "ClimbSettings.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbLongHangTest, "ClimbSystem.Climb.LongHang",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/* A climber left hanging for longer than the soak's grab snap limit only snaps once, when it grabs. The height probe
+grabs again every frame it hangs, and none of those grabs may keep the snap running*/
+bool FClimbLongHangTest::RunTest(const FString& Parameters)
+{
+	static const float HangSeconds = 4.0f;
+
+	FClimbTestWorld TestWorld;
+
+	TestWorld.AddWall(FVector(150.0f, 0.0f, 150.0f), FVector(50.0f, 2000.0f, 150.0f));
+	AClimbSystemCharacter* Climber = TestWorld.SpawnClimber(FVector(40.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+
+	if (!TestNotNull(TEXT("Climber spawned"), Climber))
+		return false;
+
+	float LongestGrabSnap = 0.0f;
+
+	for (float Elapsed = 0.0f; Elapsed < HangSeconds; Elapsed += FClimbTestWorld::FrameSeconds)
+	{
+		TestWorld.Tick(FClimbTestWorld::FrameSeconds);
+		LongestGrabSnap = FMath::Max(LongestGrabSnap, Climber->GetGrabSnapTime());
+	}
+
+	//The snap interpolates over GrabSnapTime, and LedgeMovementFinished runs on the frame after it ends.
+	const float MaxGrabSnap = FClimbProbeSettings::Get().GrabSnapTime + 2.0f * FClimbTestWorld::FrameSeconds;
+
+	TestTrue(TEXT("Climber still hangs"), Climber->IsHanging());
+	TestEqual(TEXT("No grab snap running at the end of the hang"), Climber->GetGrabSnapTime(), 0.0f);
+	TestTrue(FString::Printf(TEXT("Longest grab snap (%.2f s) within GrabSnapTime (%.2f s)"), LongestGrabSnap, MaxGrabSnap), LongestGrabSnap <= MaxGrabSnap);
+
+	return true;
+}
+
+#endif
@@ -0,0 +1,64 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbTestWorld.h"
+#include "ClimbNavLinks.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbNavLinkGrabTest, "ClimbSystem.Climb.NavLinkGrab",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/* A climb nav link grabs a ledge where the probes would have: same distance from the wall, same height, same facing*/
+bool FClimbNavLinkGrabTest::RunTest(const FString& Parameters)
+{
+	static const float LinkY = 500.0f;
+
+	//Wall face at X 100, top at 300, long enough for both climbers.
+	FClimbTestWorld TestWorld;
+	TestWorld.AddWall(FVector(150.0f, 0.0f, 150.0f), FVector(50.0f, 2000.0f, 150.0f));
+
+	AClimbSystemCharacter* ProbedClimber	= TestWorld.SpawnClimber(FVector(40.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+	AClimbSystemCharacter* LinkClimber		= TestWorld.SpawnClimber(FVector(-200.0f, LinkY, 200.0f), FRotator::ZeroRotator);
+
+	if (!TestNotNull(TEXT("Probed climber spawned"), ProbedClimber) || !TestNotNull(TEXT("Link climber spawned"), LinkClimber))
+		return false;
+
+	if (!TestTrue(TEXT("Probed climber grabs the ledge"), TestWorld.TickUntilSettled(ProbedClimber)))
+		return false;
+
+	//What the scanner stores for that wall: the face and the top of the ledge, on the surface.
+	FClimbTraversal Traversal;
+	Traversal.Type			= EClimbTraversal::GrabAndClimb;
+	Traversal.WallLocation	= FVector(100.0f, LinkY, 300.0f);
+	Traversal.WallNormal	= FVector(-1.0f, 0.0f, 0.0f);
+	Traversal.LedgeLocation = FVector(100.0f, LinkY, 300.0f);
+
+	if (!TestTrue(TEXT("Link climber starts the traversal"), LinkClimber->ExecuteClimbTraversal(Traversal)))
+		return false;
+
+	//The snap lands on the hang spot, and only then does the link go on to climb on top.
+	const bool bLanded = TestWorld.TickUntil([LinkClimber]()
+	{
+		FClimbSnapshot Snapshot;
+		LinkClimber->SaveClimbSnapshot(Snapshot);
+
+		return !Snapshot.HasFlag(FClimbSnapshot::GrabSnapping);
+	}, 2.0f);
+
+	if (!TestTrue(TEXT("Link climber's grab snap lands"), bLanded))
+		return false;
+
+	const FVector ProbedLocation	= ProbedClimber->GetActorLocation();
+	const FVector LinkLocation		= LinkClimber->GetActorLocation() - FVector(0.0f, LinkY, 0.0f);
+
+	TestEqual(TEXT("Link grab distance from the wall"), LinkLocation.X, ProbedLocation.X, 1.0f);
+	TestEqual(TEXT("Link grab height"), LinkLocation.Z, ProbedLocation.Z, 1.0f);
+	TestEqual(TEXT("Link grab facing"), LinkClimber->GetActorRotation().Yaw, ProbedClimber->GetActorRotation().Yaw, 1.0f);
+
+	return true;
+}
+
+#endif
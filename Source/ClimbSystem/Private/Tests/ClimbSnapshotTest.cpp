@@ -0,0 +1,139 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbSnapshotRestoreTest, "ClimbSystem.Climb.SnapshotRestore",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+namespace ClimbSnapshotTest
+{
+	static const float Tolerance = 0.1f;
+
+	/* Compares every field on its own, so a failure names the one that didn't come back*/
+	void TestSnapshotsEqual(FAutomationTestBase& Test, const TCHAR* What, const FClimbSnapshot& Expected, const FClimbSnapshot& Actual)
+	{
+		Test.TestEqual(FString::Printf(TEXT("%s: Location"), What), Actual.Location, Expected.Location, Tolerance);
+		Test.TestEqual(FString::Printf(TEXT("%s: Rotation"), What), Actual.Rotation.Rotator(), Expected.Rotation.Rotator(), Tolerance);
+		Test.TestEqual(FString::Printf(TEXT("%s: Velocity"), What), Actual.Velocity, Expected.Velocity, Tolerance);
+		Test.TestEqual(FString::Printf(TEXT("%s: WallLocation"), What), Actual.WallLocation, Expected.WallLocation, Tolerance);
+		Test.TestEqual(FString::Printf(TEXT("%s: WallNormal"), What), Actual.WallNormal, Expected.WallNormal, KINDA_SMALL_NUMBER);
+		Test.TestEqual(FString::Printf(TEXT("%s: WallHeightLocation"), What), Actual.WallHeightLocation, Expected.WallHeightLocation, Tolerance);
+		Test.TestEqual(FString::Printf(TEXT("%s: HangTime"), What), Actual.HangTime, Expected.HangTime, 1.0e-3f);
+		Test.TestEqual(FString::Printf(TEXT("%s: Flags"), What), (int32)Actual.Flags, (int32)Expected.Flags);
+		Test.TestEqual(FString::Printf(TEXT("%s: MovementMode"), What), (int32)Actual.MovementMode, (int32)Expected.MovementMode);
+		Test.TestEqual(FString::Printf(TEXT("%s: Transition"), What), (int32)Actual.Transition, (int32)Expected.Transition);
+	}
+
+	/* Saves halfway through whatever the climber is doing, restores it right away and checks what came back.
+	A transition doesn't come back: it lands on the saved ledge, so it is expected gone with everything that only lives during it*/
+	void TestRestore(FAutomationTestBase& Test, FClimbTestWorld& TestWorld, AClimbSystemCharacter* Climber, const TCHAR* What,
+		EClimbTransition SavedTransition)
+	{
+		FClimbSnapshot Saved;
+		Climber->SaveClimbSnapshot(Saved);
+
+		Test.TestEqual(FString::Printf(TEXT("%s: transition in flight when saved"), What), (int32)Saved.Transition, (int32)SavedTransition);
+
+		Climber->RestoreClimbSnapshot(Saved);
+
+		FClimbSnapshot Restored;
+		Climber->SaveClimbSnapshot(Restored);
+
+		FClimbSnapshot Expected = Saved;
+
+		if (Saved.Transition != EClimbTransition::None)
+		{
+			Expected.Transition	= EClimbTransition::None;
+			Expected.Flags		= (uint16)(Expected.Flags & ~(FClimbSnapshot::Jumping | FClimbSnapshot::PendingGrabLedge | FClimbSnapshot::PendingInputEnable | FClimbSnapshot::InputDisabled));
+
+			//Landing on the saved ledge snaps to it, unless the capsule already sits on its grab target.
+			Expected.Flags		= (uint16)(Expected.Flags | (Restored.Flags & FClimbSnapshot::GrabSnapping));
+		}
+
+		TestSnapshotsEqual(Test, What, Expected, Restored);
+
+		if (!Test.TestTrue(FString::Printf(TEXT("%s: climber hangs again after the restore"), What), TestWorld.TickUntilSettled(Climber)))
+			return;
+
+		//Landed or not, the restored climber hangs from the ledge it was saved on, not the one a transition was heading for.
+		FClimbSnapshot Settled;
+		Climber->SaveClimbSnapshot(Settled);
+
+		Test.TestEqual(FString::Printf(TEXT("%s: settled on the saved ledge"), What), Settled.WallHeightLocation.Z, Saved.WallHeightLocation.Z, Tolerance);
+		Test.TestEqual(FString::Printf(TEXT("%s: settled facing the saved wall"), What), Settled.WallNormal, Saved.WallNormal, KINDA_SMALL_NUMBER);
+	}
+}
+
+/* Save and restore while hanging, halfway through a side jump and halfway through a corner turn*/
+bool FClimbSnapshotRestoreTest::RunTest(const FString& Parameters)
+{
+	using namespace ClimbSnapshotTest;
+
+	const FClimbSimulationTimings Timings;
+
+	//Hanging still on a long wall.
+	{
+		FClimbTestWorld TestWorld;
+		TestWorld.AddWall(FVector(150.0f, 0.0f, 150.0f), FVector(50.0f, 2000.0f, 150.0f));
+
+		AClimbSystemCharacter* Climber = TestWorld.SpawnClimber(FVector(40.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+		if (!TestNotNull(TEXT("Climber spawned"), Climber) || !TestTrue(TEXT("Climber grabs the ledge"), TestWorld.TickUntilSettled(Climber)))
+			return false;
+
+		TestWorld.Tick(0.5f);
+		TestRestore(*this, TestWorld, Climber, TEXT("Hang"), EClimbTransition::None);
+	}
+
+	//Side jump across the gap between two walls in line. The first ends at Y 30, the second starts at Y 110.
+	{
+		FClimbTestWorld TestWorld;
+		TestWorld.AddWall(FVector(150.0f, -485.0f, 150.0f), FVector(50.0f, 515.0f, 150.0f));
+		TestWorld.AddWall(FVector(150.0f, 610.0f, 150.0f), FVector(50.0f, 500.0f, 150.0f));
+
+		AClimbSystemCharacter* Climber = TestWorld.SpawnClimber(FVector(40.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+		if (!TestNotNull(TEXT("Climber spawned"), Climber) || !TestTrue(TEXT("Climber grabs the ledge"), TestWorld.TickUntilSettled(Climber)))
+			return false;
+
+		if (!TestTrue(TEXT("Climber shimmies to the end of the first wall"), TestWorld.ShimmyToLedgeEnd(Climber, 1.0f)))
+			return false;
+
+		Climber->SetClimbMoveRightInput(1.0f);
+		if (!TestTrue(TEXT("Side jump starts"), Climber->RequestClimbAction(EClimbAction::Jump)))
+			return false;
+
+		TestWorld.Tick(Timings.SideJumpTime * 0.5f);
+		Climber->SetClimbMoveRightInput(0.0f);
+
+		TestRestore(*this, TestWorld, Climber, TEXT("Side jump"), EClimbTransition::SideJump);
+	}
+
+	//Corner turn around the right end of a lone wall.
+	{
+		FClimbTestWorld TestWorld;
+		TestWorld.AddWall(FVector(150.0f, -485.0f, 150.0f), FVector(50.0f, 515.0f, 150.0f));
+
+		AClimbSystemCharacter* Climber = TestWorld.SpawnClimber(FVector(40.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+		if (!TestNotNull(TEXT("Climber spawned"), Climber) || !TestTrue(TEXT("Climber grabs the ledge"), TestWorld.TickUntilSettled(Climber)))
+			return false;
+
+		if (!TestTrue(TEXT("Climber shimmies to the end of the wall"), TestWorld.ShimmyToLedgeEnd(Climber, 1.0f)))
+			return false;
+
+		if (!TestTrue(TEXT("Corner turn available at the end of the wall"), Climber->CanRunClimbAction(EClimbAction::RightCorner)))
+			return false;
+
+		Climber->RequestClimbAction(EClimbAction::RightCorner);
+
+		TestWorld.Tick(Timings.CornerGrabTime * 0.5f);
+		TestRestore(*this, TestWorld, Climber, TEXT("Corner turn"), EClimbTransition::CornerTurn);
+	}
+
+	return true;
+}
+
+#endif
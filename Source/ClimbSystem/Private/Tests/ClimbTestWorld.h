@@ -0,0 +1,173 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "ClimbSystem.h"
+#include "ClimbSystemCharacter.h"
+#include "Components/BoxComponent.h"
+#include "Engine/CollisionProfile.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/WorldSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/LowLevelMemTracker.h"
+
+/* Throwaway game world for the climb automation tests. Holds LedgeTrace walls and mesh-less climbers, and only
+moves when ticked. Climbers have no controller, so nothing but the climb itself moves them*/
+class FClimbTestWorld
+{
+public:
+
+	/* Frame length every tick of the test world uses*/
+	static constexpr float FrameSeconds = 1.0f / 60.0f;
+
+	FClimbTestWorld()
+	{
+		//Climbers spawned here have no animations to drive them, the timers stand in for them.
+		MeshlessClimb = IConsoleManager::Get().FindConsoleVariable(TEXT("climb.MeshlessClimb"));
+		if (MeshlessClimb)
+		{
+			PreviousMeshlessClimb	= MeshlessClimb->GetInt();
+			MeshlessClimbSetBy		= (EConsoleVariableFlags)(MeshlessClimb->GetFlags() & ECVF_SetByMask);
+			MeshlessClimb->Set(2, MeshlessClimbSetBy);
+		}
+
+		World = UWorld::CreateWorld(EWorldType::Game, false);
+
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+
+		World->InitializeActorsForPlay(FURL());
+		World->GetWorldSettings()->NotifyBeginPlay();
+	}
+
+	~FClimbTestWorld()
+	{
+		GEngine->DestroyWorldContext(World);
+		World->DestroyWorld(false);
+
+		if (MeshlessClimb)
+			MeshlessClimb->Set(PreviousMeshlessClimb, MeshlessClimbSetBy);
+	}
+
+	UWorld* GetWorld() const { return World; }
+
+	/* Box blocking the climbers and the LedgeTrace channel, like the walls of the soak course*/
+	void AddWall(const FVector& Center, const FVector& Extent)
+	{
+		AActor* Wall = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform(Center));
+
+		UBoxComponent* Box = NewObject<UBoxComponent>(Wall);
+		Box->SetBoxExtent(Extent);
+		Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Box->SetCollisionResponseToChannel(ECC_GameTraceChannel1, ECR_Block);
+		Wall->SetRootComponent(Box);
+		Box->RegisterComponent();
+		Wall->SetActorLocation(Center);
+	}
+
+	AClimbSystemCharacter* SpawnClimber(const FVector& Location, const FRotator& Rotation)
+	{
+		FActorSpawnParameters SpawnParams;
+		SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+		return World->SpawnActor<AClimbSystemCharacter>(AClimbSystemCharacter::StaticClass(), Location, Rotation, SpawnParams);
+	}
+
+	/* Ticks whole frames until Seconds have gone by*/
+	void Tick(float Seconds)
+	{
+		for (float Elapsed = 0.0f; Elapsed < Seconds; Elapsed += FrameSeconds)
+			World->Tick(LEVELTICK_All, FrameSeconds);
+	}
+
+	/* Ticks until Condition holds, for at most MaxSeconds. False if it never did*/
+	bool TickUntil(TFunctionRef<bool()> Condition, float MaxSeconds)
+	{
+		for (float Elapsed = 0.0f; Elapsed < MaxSeconds; Elapsed += FrameSeconds)
+		{
+			if (Condition())
+				return true;
+
+			World->Tick(LEVELTICK_All, FrameSeconds);
+		}
+
+		return Condition();
+	}
+
+	/* Shimmies with the given MoveRight input until the ledge runs out under the climber. False if it never stops*/
+	bool ShimmyToLedgeEnd(AClimbSystemCharacter* Climber, float MoveRightInput, float MaxSeconds = 3.0f)
+	{
+		Climber->SetClimbMoveRightInput(MoveRightInput);
+
+		FVector PreviousLocation	= Climber->GetActorLocation();
+		bool bMoved					= false;
+
+		const bool bStopped = TickUntil([Climber, &PreviousLocation, &bMoved]()
+		{
+			const FVector Location	= Climber->GetActorLocation();
+			const bool bMoving		= !Location.Equals(PreviousLocation, KINDA_SMALL_NUMBER);
+
+			bMoved				|= bMoving;
+			PreviousLocation	= Location;
+
+			return bMoved && !bMoving;
+		}, MaxSeconds);
+
+		Climber->SetClimbMoveRightInput(0.0f);
+		return bStopped;
+	}
+
+	/* Ticks until the climber hangs with its grab snap landed*/
+	bool TickUntilSettled(const AClimbSystemCharacter* Climber, float MaxSeconds = 1.0f)
+	{
+		return TickUntil([Climber]()
+		{
+			FClimbSnapshot Snapshot;
+			Climber->SaveClimbSnapshot(Snapshot);
+
+			return Snapshot.HasFlag(FClimbSnapshot::Hanging) && Snapshot.Transition == EClimbTransition::None &&
+				!(Snapshot.Flags & (FClimbSnapshot::GrabSnapping | FClimbSnapshot::PendingGrabLedge | FClimbSnapshot::PendingInputEnable));
+		}, MaxSeconds);
+	}
+
+#if ENABLE_LOW_LEVEL_MEM_TRACKER
+	/* Ticks whole frames until Seconds have gone by, and returns the most the Climb LLM tag grew over what it held
+	before the first of them. Frame-local allocations freed within the frame net out. Needs LLM on, -LLM*/
+	int64 TickMeasuringClimbMemory(float Seconds)
+	{
+		FLowLevelMemTracker& Tracker = FLowLevelMemTracker::Get();
+
+		Tracker.UpdateStatsPerFrame();
+		const int64 StartAmount = Tracker.GetTagAmountForTracker(ELLMTracker::Default, (ELLMTag)ELLMTagClimb::Climb);
+
+		int64 MaxGrowth = 0;
+		for (float Elapsed = 0.0f; Elapsed < Seconds; Elapsed += FrameSeconds)
+		{
+			World->Tick(LEVELTICK_All, FrameSeconds);
+
+			Tracker.UpdateStatsPerFrame();
+			MaxGrowth = FMath::Max(MaxGrowth, Tracker.GetTagAmountForTracker(ELLMTracker::Default, (ELLMTag)ELLMTagClimb::Climb) - StartAmount);
+		}
+
+		return MaxGrowth;
+	}
+#endif
+
+private:
+
+	UWorld* World					= nullptr;
+	IConsoleVariable* MeshlessClimb = nullptr;
+	int32 PreviousMeshlessClimb		= 0;
+	EConsoleVariableFlags MeshlessClimbSetBy = ECVF_SetByConstructor;
+};
+
+#endif
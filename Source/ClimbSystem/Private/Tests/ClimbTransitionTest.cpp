@@ -0,0 +1,147 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbTestWorld.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbTransitionLandingTest, "ClimbSystem.Climb.TransitionLanding",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FClimbMeshlessCornerTurnTest, "ClimbSystem.Climb.MeshlessCornerTurn",
+	EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+namespace ClimbTransitionTest
+{
+	/* Ticks a started transition up to a couple of frames before its landing step and checks it is still in flight, then past it
+	and checks it landed. Without a mesh the timers stand in for the GrabLedge notify, so nothing else may land it earlier*/
+	bool TestLandsOnStep(FAutomationTestBase& Test, FClimbTestWorld& TestWorld, AClimbSystemCharacter* Climber, const TCHAR* What,
+		EClimbTransition Transition, float StepSeconds)
+	{
+		static const float Margin = 2.0f * FClimbTestWorld::FrameSeconds;
+
+		TestWorld.Tick(StepSeconds - Margin);
+
+		FClimbSnapshot Snapshot;
+		Climber->SaveClimbSnapshot(Snapshot);
+
+		const bool bInFlight = Test.TestEqual(FString::Printf(TEXT("%s still in flight before its landing step"), What), (int32)Snapshot.Transition, (int32)Transition)
+			&& Test.TestTrue(FString::Printf(TEXT("%s still waiting on its grab before its landing step"), What), Snapshot.HasFlag(FClimbSnapshot::PendingGrabLedge));
+
+		TestWorld.Tick(2.0f * Margin);
+		Climber->SaveClimbSnapshot(Snapshot);
+
+		const bool bLanded = Test.TestEqual(FString::Printf(TEXT("%s landed after its landing step"), What), (int32)Snapshot.Transition, (int32)EClimbTransition::None)
+			&& Test.TestFalse(FString::Printf(TEXT("%s grab ran after its landing step"), What), Snapshot.HasFlag(FClimbSnapshot::PendingGrabLedge));
+
+		return bInFlight && bLanded;
+	}
+}
+
+/* Side jumps and corner turns end on their GrabLedge step, not on the first frame the height probe sees the ledge they started from*/
+bool FClimbTransitionLandingTest::RunTest(const FString& Parameters)
+{
+	using namespace ClimbTransitionTest;
+
+	const FClimbSimulationTimings Timings;
+
+	//Side jump across the gap between two walls in line. The first ends at Y 30, the second starts at Y 110.
+	{
+		FClimbTestWorld TestWorld;
+		TestWorld.AddWall(FVector(150.0f, -485.0f, 150.0f), FVector(50.0f, 515.0f, 150.0f));
+		TestWorld.AddWall(FVector(150.0f, 610.0f, 150.0f), FVector(50.0f, 500.0f, 150.0f));
+
+		AClimbSystemCharacter* Climber = TestWorld.SpawnClimber(FVector(40.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+		if (!TestNotNull(TEXT("Climber spawned"), Climber) || !TestTrue(TEXT("Climber grabs the ledge"), TestWorld.TickUntilSettled(Climber)))
+			return false;
+
+		if (!TestTrue(TEXT("Climber shimmies to the end of the first wall"), TestWorld.ShimmyToLedgeEnd(Climber, 1.0f)))
+			return false;
+
+		const FVector StartLocation = Climber->GetActorLocation();
+
+		Climber->SetClimbMoveRightInput(1.0f);
+		if (!TestTrue(TEXT("Side jump starts"), Climber->RequestClimbAction(EClimbAction::Jump)))
+			return false;
+
+		Climber->SetClimbMoveRightInput(0.0f);
+
+		if (TestLandsOnStep(*this, TestWorld, Climber, TEXT("Side jump"), EClimbTransition::SideJump, Timings.SideJumpTime))
+		{
+			TestTrue(TEXT("Side jump lands on the second wall"), TestWorld.TickUntilSettled(Climber));
+			TestTrue(TEXT("Side jump crossed the gap"), Climber->GetActorLocation().Y - StartLocation.Y > 100.0f);
+		}
+	}
+
+	//Corner turn around the right end of a lone wall.
+	{
+		FClimbTestWorld TestWorld;
+		TestWorld.AddWall(FVector(150.0f, -485.0f, 150.0f), FVector(50.0f, 515.0f, 150.0f));
+
+		AClimbSystemCharacter* Climber = TestWorld.SpawnClimber(FVector(40.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+		if (!TestNotNull(TEXT("Climber spawned"), Climber) || !TestTrue(TEXT("Climber grabs the ledge"), TestWorld.TickUntilSettled(Climber)))
+			return false;
+
+		if (!TestTrue(TEXT("Climber shimmies to the end of the wall"), TestWorld.ShimmyToLedgeEnd(Climber, 1.0f)))
+			return false;
+
+		if (!TestTrue(TEXT("Corner turn available at the end of the wall"), Climber->CanRunClimbAction(EClimbAction::RightCorner)))
+			return false;
+
+		Climber->RequestClimbAction(EClimbAction::RightCorner);
+
+		if (TestLandsOnStep(*this, TestWorld, Climber, TEXT("Corner turn"), EClimbTransition::CornerTurn, Timings.CornerGrabTime))
+			TestTrue(TEXT("Corner turn gives the input back and hangs"), TestWorld.TickUntilSettled(Climber, Timings.CornerInputTime));
+	}
+
+	return true;
+}
+
+/* Without a mesh the corner step itself carries the climber around the corner: past the wall end and turned to face its side*/
+bool FClimbMeshlessCornerTurnTest::RunTest(const FString& Parameters)
+{
+	const FClimbSimulationTimings Timings;
+
+	//Wall from Y -1000 to Y 30, face at X 100, back at X 200. Its right end is the side to turn onto.
+	FClimbTestWorld TestWorld;
+	TestWorld.AddWall(FVector(150.0f, -485.0f, 150.0f), FVector(50.0f, 515.0f, 150.0f));
+
+	AClimbSystemCharacter* Climber = TestWorld.SpawnClimber(FVector(40.0f, 0.0f, 200.0f), FRotator::ZeroRotator);
+	if (!TestNotNull(TEXT("Climber spawned"), Climber) || !TestTrue(TEXT("Climber grabs the ledge"), TestWorld.TickUntilSettled(Climber)))
+		return false;
+
+	if (!TestTrue(TEXT("Climber shimmies to the end of the wall"), TestWorld.ShimmyToLedgeEnd(Climber, 1.0f)))
+		return false;
+
+	if (!TestTrue(TEXT("Corner turn available at the end of the wall"), Climber->CanRunClimbAction(EClimbAction::RightCorner)))
+		return false;
+
+	const FTransform StartTransform = Climber->GetActorTransform();
+	Climber->RequestClimbAction(EClimbAction::RightCorner);
+
+	//On the frame after the step, before the grab snap has pulled it far.
+	TestWorld.Tick(Timings.CornerGrabTime + FClimbTestWorld::FrameSeconds);
+
+	const FVector StepLocation	= Climber->GetActorLocation();
+	const float StepYaw			= FRotator::NormalizeAxis(Climber->GetActorRotation().Yaw);
+
+	TestTrue(FString::Printf(TEXT("Corner step moved the climber past the end of the wall (%s)"), *StepLocation.ToString()), StepLocation.Y > 30.0f);
+	TestTrue(FString::Printf(TEXT("Corner step moved the climber into the wall depth (%s)"), *StepLocation.ToString()), StepLocation.X > StartTransform.GetLocation().X + 30.0f);
+	TestEqual(TEXT("Corner step turned the climber"), StepYaw, FRotator::NormalizeAxis(StartTransform.Rotator().Yaw - 90.0f), 5.0f);
+
+	//Once settled it hangs from the side of the wall, facing it.
+	if (!TestTrue(TEXT("Climber hangs after the corner turn"), TestWorld.TickUntilSettled(Climber, Timings.CornerInputTime)))
+		return false;
+
+	const FVector Location = Climber->GetActorLocation();
+
+	TestTrue(TEXT("Climber is past the end of the wall"), Location.Y > 30.0f);
+	TestTrue(TEXT("Climber is along the side of the wall"), Location.X > 100.0f && Location.X < 200.0f);
+	TestEqual(TEXT("Climber faces the side of the wall"), FRotator::NormalizeAxis(Climber->GetActorRotation().Yaw), -90.0f, 5.0f);
+
+	return true;
+}
+
+#endif
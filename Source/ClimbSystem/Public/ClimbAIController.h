@@ -0,0 +1,44 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AIController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "ClimbAIController.generated.h"
+
+class AClimbSystemCharacter;
+
+/* Path following that hands AClimbNavLinks links to the climber, and waits for it instead of steering through them*/
+UCLASS()
+class UClimbPathFollowingComponent : public UPathFollowingComponent
+{
+	GENERATED_BODY()
+
+protected:
+
+	virtual void SetMoveSegment(int32 SegmentStartIndex) override;
+	virtual void FollowPathSegment(float DeltaTime) override;
+	virtual bool HasReachedCurrentTarget(const FVector& CurrentLocation) const override;
+
+private:
+
+	bool bClimbTraversal = false;
+
+	AClimbSystemCharacter* GetClimber() const;
+	/* True while the current segment is a climb link the climber hasn't finished*/
+	bool IsClimbing() const;
+};
+
+/* AI controller for climbers. MoveTo paths through climb nav links like through any other link*/
+UCLASS()
+class AClimbAIController : public AAIController
+{
+	GENERATED_BODY()
+
+public:
+	AClimbAIController(const FObjectInitializer& ObjectInitializer);
+};
@@ -0,0 +1,51 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/GameInstanceSubsystem.h"
+#include "Engine/StreamableManager.h"
+#include "ClimbAssetSubsystem.generated.h"
+
+class APawn;
+
+/* Streams the climber pawn class and the climb montages it points to. Every class gets one batched
+async request, and what it loads stays in memory for all climbers of that class until the game ends.
+-ClimbSyncLoad loads everything synchronously instead, to compare startup times.*/
+UCLASS()
+class UClimbAssetSubsystem : public UGameInstanceSubsystem
+{
+	GENERATED_BODY()
+
+public:
+
+	virtual void Initialize(FSubsystemCollection& Collection) override;
+	virtual void Deinitialize() override;
+
+	/* Loads a climber class, starts loading its climb assets and then calls OnLoaded*/
+	void RequestClimberClass(const TSoftClassPtr<APawn>& ClimberClass, FSimpleDelegate OnLoaded);
+	/* Loads the climb assets of a climber class. True if they are already in memory, otherwise OnLoaded is called once they are*/
+	bool RequestClimbAssets(UClass* ClimberClass, FSimpleDelegate OnLoaded);
+
+private:
+
+	struct FClimbAssetRequest
+	{
+		TSharedPtr<FStreamableHandle> Handle;
+		TArray<FSimpleDelegate> WaitingClimbers;
+		double RequestTime	= 0.0;
+		int32 NumAssets		= 0;
+		bool bLoaded		= false;
+	};
+
+	FStreamableManager Streamable;
+	TMap<FName, FClimbAssetRequest> Requests;
+	TArray<TSharedPtr<FStreamableHandle>> ClassHandles;
+	bool bSyncLoad = false;
+
+	void OnClimberClassLoaded(TSoftClassPtr<APawn> ClimberClass, FSimpleDelegate OnLoaded, double RequestTime);
+	void OnClimbAssetsLoaded(FName ClassName);
+};
@@ -0,0 +1,166 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+// Engine independent climb math and decisions. Only plain data goes in and out,
+// so nothing in here may include engine headers or touch UObjects.
+
+#include <cstdint>
+
+namespace ClimbCore
+{
+	struct FVec3
+	{
+		float X = 0.0f;
+		float Y = 0.0f;
+		float Z = 0.0f;
+	};
+
+	struct FRot
+	{
+		float Pitch = 0.0f;
+		float Yaw	= 0.0f;
+		float Roll	= 0.0f;
+	};
+
+	//*******************************************************************************************************************
+	//		RULES
+	//*******************************************************************************************************************
+
+	namespace Rules
+	{
+		/* Sphere used by the forward, height and corner probes*/
+		constexpr float ProbeSphereRadius		= 20.0f;
+		constexpr float ForwardProbeLength		= 150.0f;
+		constexpr float HeightProbeStart		= 500.0f;
+		constexpr float HeightProbeForward		= 70.0f;
+		constexpr float CornerProbeRise			= 60.0f;
+		constexpr float CornerProbeLength		= 70.0f;
+
+		/* Capsules used by the side, side ledge and up probes*/
+		constexpr float SideCapsuleRadius		= 20.0f;
+		constexpr float SideCapsuleHalfHeight	= 60.0f;
+		constexpr float LedgeCapsuleRadius		= 25.0f;
+		constexpr float LedgeCapsuleHalfHeight	= 60.0f;
+		constexpr float UpCapsuleRadius			= 20.0f;
+		constexpr float UpCapsuleHalfHeight		= 100.0f;
+
+		/* Probe origins relative to the capsule*/
+		constexpr FVec3 RightArrowOffset		= { 40.0f,   70.0f,  40.0f };
+		constexpr FVec3 LeftArrowOffset			= { 40.0f,  -70.0f,  40.0f };
+		constexpr FVec3 RightLedgeOffset		= { 50.0f,  150.0f,  40.0f };
+		constexpr FVec3 LeftLedgeOffset			= { 50.0f, -150.0f,  40.0f };
+		constexpr FVec3 UpArrowOffset			= { 65.0f,    0.0f, 290.0f };
+
+		/* The ledge can be grabbed while pelvis height minus ledge height is inside this range*/
+		constexpr float PelvisRangeMin			= -50.0f;
+		constexpr float PelvisRangeMax			= 0.0f;
+
+		/* Where GrabLedge leaves the capsule: off the wall along its normal and under the ledge*/
+		constexpr float HangWallOffset			= 22.0f;
+		constexpr float HangHeightOffset		= 120.0f;
+		constexpr float GrabSnapTime			= 0.13f;
+		/* Closer than this to the grab target, in centimetres and degrees, the capsule is placed instead of snapped*/
+		constexpr float GrabSnapTolerance		= 2.0f;
+
+		/* Interpolation speed of the shimmy while hanging*/
+		constexpr float MoveSidesSpeed			= 17.0f;
+
+		/* Seconds a climb action pressed too early waits for its move to become possible*/
+		constexpr float InputBufferWindow		= 0.2f;
+		constexpr int32_t MaxBufferedActions	= 8;
+
+		/* Ledge path followed by the shimmy. Each new edge point is one wall probe and one top probe, one step away*/
+		constexpr float LedgePathStep			= 25.0f;
+		constexpr float LedgePathWallReach		= 60.0f;
+		constexpr float LedgePathTopInset		= 30.0f;
+		constexpr float LedgePathTopRise		= 60.0f;
+		/* Steepest height change and sharpest bend between two edge points that still count as the same ledge*/
+		constexpr float LedgePathMaxStepHeight	= 30.0f;
+		constexpr float LedgePathMinBendCos		= 0.7f;
+		/* Edge points further behind the character than this are forgotten*/
+		constexpr float LedgePathKeepBehind		= 100.0f;
+
+		/* Mesh-less climb: where the PelvisSocket sits relative to the capsule, and how long each animation driven
+		transition takes. Close to the default animations*/
+		constexpr FVec3 PelvisCapsuleOffset		= { 0.0f, 0.0f, 90.0f };
+		constexpr float ClimbLedgeTime			= 1.3f;
+		constexpr float SideJumpTime			= 0.6f;
+		constexpr float CornerGrabTime			= 0.8f;
+		constexpr float CornerInputTime			= 1.0f;
+		constexpr float JumpUpTime				= 0.7f;
+		/* Capsule moves of the mesh-less transitions, standing in for the root motion of the animations. Right side, Y is mirrored for the left*/
+		constexpr FVec3 SideJumpOffset			= { 0.0f, 150.0f, 0.0f };
+		constexpr FVec3 CornerTurnOffset		= { 60.0f, 60.0f, 0.0f };
+		constexpr FVec3 JumpUpOffset			= { 0.0f, 0.0f, 200.0f };
+	}
+
+	//*******************************************************************************************************************
+	//		GRAB
+	//*******************************************************************************************************************
+
+	struct FGrabInput
+	{
+		FVec3 WallLocation;
+		FVec3 WallNormal;
+		float LedgeHeight = 0.0f;
+	};
+
+	struct FGrabTarget
+	{
+		FVec3 Location;
+		FRot Rotation;
+	};
+
+	/* Capsule location and rotation GrabLedge moves to, facing the wall*/
+	FGrabTarget ComputeGrabTarget(const FGrabInput& Input);
+
+	/* True if the pelvis is close enough under the ledge to grab it*/
+	bool IsPelvisInGrabRange(float PelvisHeight, float LedgeHeight);
+
+	//*******************************************************************************************************************
+	//		JUMP
+	//*******************************************************************************************************************
+
+	enum class EJumpAction : uint8_t
+	{
+		None,
+		Jump,
+		ClimbLedge,
+		JumpRight,
+		JumpLeft,
+		JumpUp,
+		JumpBack
+	};
+
+	struct FJumpInput
+	{
+		bool bIsHanging		= false;
+		bool bTurnedBack	= false;
+		bool bIsJumping		= false;
+		bool bCanJumpRight	= false;
+		bool bCanJumpLeft	= false;
+		bool bCanJumpUp		= false;
+		float MoveRightAxis	= 0.0f;
+	};
+
+	/* What pressing Jump does for the given climb state*/
+	EJumpAction DecideJumpAction(const FJumpInput& Input);
+
+	//*******************************************************************************************************************
+	//		SIDES
+	//*******************************************************************************************************************
+
+	struct FSideOptions
+	{
+		bool bCanJump = false;
+		bool bCanTurn = false;
+	};
+
+	/* Side jump and corner options for one side. The ledge probe only matters when the character can't
+	shimmy that way, and the corner probe only when it can't jump either, same order the probes run in*/
+	FSideOptions EvaluateSide(bool bCanMove, bool bLedgeProbeHit, bool bCornerProbeHit);
+}
@@ -0,0 +1,51 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/* One sample of a ledge edge. WallLocation and WallNormal mean the same as the forward probe ones*/
+struct FClimbLedgePoint
+{
+	FVector WallLocation;
+	FVector WallNormal;
+	float LedgeHeight	= 0.0f;
+	/* Distance along the ledge from where the path was extracted. Grows to the right*/
+	float Distance		= 0.0f;
+};
+
+/* Edge of the ledge the character hangs from, extended one point at a time as the character shimmies along it*/
+class CLIMBSYSTEM_API FClimbLedgePath
+{
+public:
+
+	/* Starts a new path from a single edge point*/
+	void Reset(const FVector& WallLocation, const FVector& WallNormal, float LedgeHeight);
+	/* Forgets the path. The shimmy falls back to the side probes until a new one is extracted*/
+	void Invalidate();
+	bool IsValid() const { return Points.Num() > 0; }
+
+	/* Last edge point on that side*/
+	const FClimbLedgePoint& GetEnd(bool bRight) const { return bRight ? Points.Last() : Points[0]; }
+	float GetMinDistance() const { return Points[0].Distance; }
+	float GetMaxDistance() const { return Points.Last().Distance; }
+
+	/* Adds an edge point past the end of the path on that side*/
+	void Extend(bool bRight, const FVector& WallLocation, const FVector& WallNormal, float LedgeHeight);
+	/* Edge point at the given distance, interpolated between the two closest points*/
+	FClimbLedgePoint Sample(float Distance) const;
+	/* Drops edge points more than KeepBehind away from the given distance*/
+	void Trim(float Distance, float KeepBehind);
+
+	/* True once extending that side failed, so the end of the ledge is not probed again*/
+	bool bRightEndReached	= false;
+	bool bLeftEndReached	= false;
+
+private:
+
+	/* Trimmed to a few steps on each side of the character, so it stays in the inline storage*/
+	TArray<FClimbLedgePoint, TInlineAllocator<16>> Points;
+};
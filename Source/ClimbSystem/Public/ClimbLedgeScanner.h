@@ -0,0 +1,95 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UWorld;
+class UPrimitiveComponent;
+
+/* Character values the scanner needs to decide if a ledge can be reached by jumping*/
+struct CLIMBSYSTEM_API FClimbReachSettings
+{
+	float CapsuleRadius			= 42.0f;
+	float CapsuleHalfHeight		= 96.0f;
+	float JumpZVelocity			= 600.0f;
+	float GravityZ				= -980.0f;
+};
+
+/* One point along the top edge of a LedgeTrace primitive and what the climb probes would do there*/
+struct CLIMBSYSTEM_API FClimbLedgeSample
+{
+	/* Point of the wall face at the height of the ledge top, on the surface*/
+	FVector LedgeLocation		= FVector::ZeroVector;
+	FVector WallNormal			= FVector::ZeroVector;
+	/* Where GrabLedge leaves the capsule, from the wall and ledge as the probes see them*/
+	FVector HangLocation		= FVector::ZeroVector;
+	float	FloorHeight			= 0.0f;
+	int32	NearbyPrimitives	= 0;
+
+	bool bForwardProbeHit		= false;
+	bool bHeightProbeHit		= false;
+	bool bInJumpReach			= false;
+	bool bGrabbable				= false;
+	bool bCanMoveRight			= false;
+	bool bCanMoveLeft			= false;
+	bool bCanJumpRight			= false;
+	bool bCanJumpLeft			= false;
+	bool bCanJumpUp				= false;
+};
+
+#if WITH_EDITOR
+
+/* A primitive that blocks the LedgeTrace channel. Its edges come from its local box, so a rotated wall keeps its own edges*/
+struct CLIMBSYSTEM_API FClimbablePrimitive
+{
+	TWeakObjectPtr<UPrimitiveComponent> Component;
+	FBox Bounds;
+	FBox LocalBox;
+	FTransform Transform;
+	/* False for shapes the local box doesn't describe, like cylinders. Their edges are the box's and may miss the real ledge*/
+	bool bIsBox;
+};
+
+/* Finds ledge edges in a world and evaluates them against the climb rules of AClimbSystemCharacter.
+Edges are the top edges of each primitive's local box, which fits boxes at any yaw. Other shapes, and primitives
+tilted off the vertical, are counted and warned about. Editor only: used by the ClimbAnalysis commandlet and to generate climb nav links*/
+class CLIMBSYSTEM_API FClimbLedgeScanner
+{
+public:
+
+	FClimbLedgeScanner(UWorld* InWorld, const FClimbReachSettings& InReachSettings, float InSampleSpacing = 50.0f);
+
+	/* Collects every registered primitive blocking ECC_GameTraceChannel1*/
+	void GatherPrimitives();
+	/* Samples the top edges of the gathered primitives in parallel and runs the climb probes on each sample*/
+	void ScanLedges();
+	/* Number of gathered primitives whose bounds touch the given box*/
+	int32 CountPrimitivesInBox(const FBox& Box) const;
+
+	const TArray<FClimbablePrimitive>& GetPrimitives() const	{ return Primitives; }
+	const TArray<FClimbLedgeSample>& GetSamples() const			{ return Samples; }
+	FBox GetPrimitivesBounds() const;
+
+	/* How far from the character the hanging probes reach. Used for the probe cost estimate*/
+	static const float ProbeReach;
+
+private:
+
+	UWorld* World;
+	FClimbReachSettings ReachSettings;
+	float SampleSpacing;
+
+	TArray<FClimbablePrimitive> Primitives;
+	TArray<FClimbLedgeSample> Samples;
+
+	/* Samples the four top edges of one primitive's local box*/
+	void ScanPrimitive(const FClimbablePrimitive& Primitive, TArray<FClimbLedgeSample>& OutSamples) const;
+	/* Fills the sample running the same probes the character runs while approaching and hanging*/
+	bool EvaluateEdgePoint(const FVector& EdgePoint, const FVector& OutwardNormal, FClimbLedgeSample& OutSample) const;
+};
+
+#endif
@@ -0,0 +1,140 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "AI/Navigation/NavRelevantInterface.h"
+#include "AI/Navigation/NavLinkDefinition.h"
+#include "ClimbNavLinks.generated.h"
+
+class AClimbSystemCharacter;
+class FClimbLedgeScanner;
+struct FClimbReachSettings;
+
+UENUM()
+enum class EClimbTraversal : uint8
+{
+	/* Grab the ledge from the floor and climb on top*/
+	GrabAndClimb,
+	/* Grab the ledge, side jump to the next one and climb on top of it*/
+	SideJump,
+	/* Grab the ledge, jump up to the one above and climb on top of it*/
+	JumpUp,
+	/* Walk off the top of the ledge down to the floor*/
+	DropDown
+};
+
+/* Everything a climber needs to run one climb nav link without probing. Walls and ledges are the surface points the scanner found,
+ExecuteClimbTraversal moves them out by the probe radius to where the character's own probes would have put them*/
+USTRUCT()
+struct FClimbTraversal
+{
+	GENERATED_BODY()
+
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	EClimbTraversal Type = EClimbTraversal::GrabAndClimb;
+
+	/* Ends of the nav link, on the navmesh*/
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	FVector Start = FVector::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	FVector End = FVector::ZeroVector;
+
+	/* Ledge grabbed first: wall hit, wall normal and the top of the ledge*/
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	FVector WallLocation = FVector::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	FVector WallNormal = FVector::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	FVector LedgeLocation = FVector::ZeroVector;
+
+	/* Ledge the side jump or jump up lands on, climbed on top of at the end*/
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	FVector TargetWallLocation = FVector::ZeroVector;
+
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	FVector TargetLedgeLocation = FVector::ZeroVector;
+
+	/* Side jumps only*/
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	bool bRight = false;
+};
+
+/*
+ * Nav links for climbing, generated from the ledges FClimbLedgeScanner finds under the current climb rules.
+ * Generate in the editor to save them with the level, or leave them empty and they are generated on BeginPlay in PIE.
+ * The scanner is editor only, so cooked games only have the links saved with the level.
+ * AClimbAIController runs them through ExecuteClimbTraversal.
+ */
+UCLASS()
+class AClimbNavLinks : public AActor, public INavRelevantInterface
+{
+	GENERATED_BODY()
+
+public:
+	AClimbNavLinks();
+
+	/* Character whose capsule and jump decide which ledges can be reached*/
+	UPROPERTY(EditAnywhere, Category = Climb)
+	TSubclassOf<AClimbSystemCharacter> ClimberClass;
+
+	/* Distance between two ledge samples, and the least distance between two links of the same kind*/
+	UPROPERTY(EditAnywhere, Category = Climb)
+	float SampleSpacing = 50.0f;
+
+	UPROPERTY(EditAnywhere, Category = Climb)
+	float LinkSpacing = 200.0f;
+
+#if WITH_EDITORONLY_DATA
+	UPROPERTY(EditAnywhere, Category = Climb)
+	bool bGenerateOnBeginPlay = true;
+#endif
+
+#if WITH_EDITOR
+	/* Scans the level and replaces the links*/
+	UFUNCTION(CallInEditor, Category = Climb)
+	void Generate();
+#endif
+
+	/* Link whose ends are closest to Start and End, within Tolerance. Null if there is none*/
+	const FClimbTraversal* FindTraversal(const FVector& Start, const FVector& End, float Tolerance = 100.0f) const;
+	const TArray<FClimbTraversal>& GetTraversals() const { return Traversals; }
+
+	/* Links of every AClimbNavLinks in the world*/
+	static const FClimbTraversal* FindTraversalInWorld(UWorld* World, const FVector& Start, const FVector& End);
+
+	virtual void GetNavigationData(FNavigationRelevantData& Data) const override;
+	virtual FBox GetNavigationBounds() const override;
+	virtual bool IsNavigationRelevant() const override;
+
+protected:
+
+	virtual void BeginPlay() override;
+	virtual void PostLoad() override;
+
+private:
+
+	UPROPERTY(VisibleAnywhere, Category = Climb)
+	TArray<FClimbTraversal> Traversals;
+
+	/* Nav links made from Traversals, same order*/
+	TArray<FNavigationLink> NavLinks;
+	TMultiMap<FIntVector, int32> TraversalGrid;
+
+	FBox NavLinksBounds;
+
+#if WITH_EDITOR
+	/* Turns the ledge samples into one link per kind and place, at least LinkSpacing apart*/
+	void AddTraversals(const FClimbLedgeScanner& Scanner, const FClimbReachSettings& ReachSettings);
+#endif
+	/* Rebuilds NavLinks and the lookup grid, and tells the navigation system if asked to*/
+	void RebuildNavLinks(bool bUpdateNavigation);
+	FIntVector GetGridCell(const FVector& Location) const;
+};
@@ -0,0 +1,55 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/IConsoleManager.h"
+
+/* Climb probe tuning taken from the climb.* console variables. Defaults are the ClimbCore rules.
+climb.ProbeQuality picks a tier, and each tier sets the probe rate, shapes, async queries and active probes*/
+struct CLIMBSYSTEM_API FClimbProbeSettings
+{
+	float ProbeSphereRadius;
+	float ForwardProbeLength;
+	float HeightProbeStart;
+	float CornerProbeLength;
+	float SideCapsuleRadius;
+	float SideCapsuleHalfHeight;
+	float LedgeCapsuleRadius;
+	float LedgeCapsuleHalfHeight;
+	float UpCapsuleRadius;
+	float UpCapsuleHalfHeight;
+	float GrabSnapTime;
+	float MoveSidesSpeed;
+	float InputBufferWindow;
+
+	/* Frames between two refreshes of a probe. The last answer is reused in between*/
+	int32 ProbeInterval;
+	/* Forward, height and corner probes become rays instead of sphere sweeps*/
+	bool bSimpleShapes;
+	/* Probes are queued as async sweeps and answered with the result of the previous query. The height probe always runs right away*/
+	bool bAsyncProbes;
+	/* One bit per EClimbProbe. Inactive probes never hit, and the moves they back are not available*/
+	uint32 ActiveProbes;
+
+	/* Radius of the forward and height probe shapes. Their hits are the shape centres, this far off the wall face
+	and above the ledge top, and GrabLedge takes them that way*/
+	float GetProbeShapeRadius() const { return bSimpleShapes ? 0.0f : ProbeSphereRadius; }
+
+	/* Values as of the last refresh. Refreshed at the end of any frame a climb.* variable changed*/
+	static const FClimbProbeSettings& Get();
+	/* Reads every climb.* variable right away*/
+	static void Refresh();
+
+	/* Number of climb.ProbeQuality tiers, lowest first*/
+	static int32 GetNumQualityTiers();
+	/* Sets climb.ProbeQuality with the given priority, and refreshes. Ignored if something with a higher priority,
+	like a device profile or the console, set it already*/
+	static void SetQualityTier(int32 Tier, EConsoleVariableFlags SetBy = ECVF_SetByScalability);
+	static int32 GetQualityTier();
+	/* Priority climb.ProbeQuality was last set with*/
+	static EConsoleVariableFlags GetQualityTierSetBy();
+};
@@ -0,0 +1,65 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Controller.h"
+#include "ClimbSystemCharacter.h"
+#include "ClimbSoakBotController.generated.h"
+
+/* Drives a climber with random input: walks and jumps at walls, then shimmies, jumps, turns corners,
+turns back and lets go at random. Goes back to its spawn point when it falls off the course.*/
+UCLASS()
+class AClimbSoakBotController : public AController
+{
+	GENERATED_BODY()
+
+public:
+	AClimbSoakBotController();
+
+	/* Spawn state of the climber, used to respawn it, and the height it counts as fallen under*/
+	void SetRespawn(const FClimbSnapshot& Snapshot, float InKillZ);
+	void SetRandomSeed(int32 Seed) { Random.Initialize(Seed); }
+	/* Seconds some of the grabs are held still before the bot does anything else. Zero holds none*/
+	void SetLongHang(float Seconds) { LongHangSeconds = Seconds; }
+	/* Puts the climber back at its spawn point*/
+	void Respawn();
+
+	int32 GetNumRespawns() const { return NumRespawns; }
+	/* Hangs held still for the whole long hang time*/
+	int32 GetNumLongHangs() const { return NumLongHangs; }
+
+	virtual void Tick(float DeltaSeconds) override;
+
+protected:
+
+	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
+
+private:
+
+	UPROPERTY(Transient)
+	AClimbSystemCharacter* Climber;
+
+	FRandomStream Random;
+	FClimbSnapshot RespawnSnapshot;
+	bool bHasRespawn		= false;
+	float KillZ				= -1000.0f;
+
+	FVector WalkDirection	= FVector::ForwardVector;
+	float MoveRightInput	= 0.0f;
+	float NextDecisionTime	= 0.0f;
+	float NextRespawnTime	= 0.0f;
+	int32 NumRespawns		= 0;
+
+	float LongHangSeconds	= 0.0f;
+	float LongHangEndTime	= -1.0f;
+	int32 NumLongHangs		= 0;
+	bool bWasHanging		= false;
+
+	/* Picks new input for the next fraction of a second*/
+	void Decide();
+};
@@ -0,0 +1,61 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "ClimbSoakCourse.generated.h"
+
+class UBoxComponent;
+
+/* Random climbing course made of box colliders on the LedgeTrace channel: plain walls, walls split by
+side jump gaps, corners, overhangs and stacked ledges, scattered over a floor. Same seed, same course.*/
+UCLASS()
+class AClimbSoakCourse : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	AClimbSoakCourse();
+
+	UPROPERTY(EditAnywhere, Category = Soak)
+	int32 Seed = 1;
+
+	/* Boxes in the course, floor not included*/
+	UPROPERTY(EditAnywhere, Category = Soak)
+	int32 NumBoxes = 2000;
+
+	/* Half size of the square the structures are scattered over*/
+	UPROPERTY(EditAnywhere, Category = Soak)
+	float HalfSize = 20000.0f;
+
+	/* Creates the boxes. Calling it again replaces the previous course*/
+	void Build();
+
+	/* Points on the floor in front of a wall, facing it*/
+	const TArray<FTransform>& GetSpawnPoints() const { return SpawnPoints; }
+	/* Height under which a climber has fallen off the course*/
+	float GetKillZ() const { return GetActorLocation().Z - 1000.0f; }
+
+protected:
+
+	virtual void OnConstruction(const FTransform& Transform) override;
+
+private:
+
+	UPROPERTY(VisibleAnywhere, Category = Soak)
+	UBoxComponent* Floor;
+
+	UPROPERTY(Transient)
+	TArray<UBoxComponent*> Boxes;
+
+	TArray<FTransform> SpawnPoints;
+
+	/* Adds one box resting on Base, in the structure space given by Frame*/
+	void AddBox(const FTransform& Frame, const FVector& Base, const FVector& Extent);
+	/* Adds one random structure at the given place and returns how many boxes it used*/
+	int32 AddStructure(FRandomStream& Random, const FTransform& Frame);
+};
@@ -0,0 +1,120 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ClimbSystemGameMode.h"
+#include "ClimbSoakGameMode.generated.h"
+
+class AClimbSoakBotController;
+class AClimbSoakCourse;
+class AClimbSystemCharacter;
+
+/*
+ * Headless climb soak. Builds a random course, fills it with bot driven climbers, checks the climb
+ * invariants every frame and reports frame time and memory drift to the log and Saved/Soak.
+ * UE4Editor ClimbSystem /Game/ThirdPersonCPP/Maps/ThirdPersonExampleMap?game=/Script/ClimbSystem.ClimbSoakGameMode
+ *		-game -nullrhi -unattended [-SoakMinutes=120] [-SoakClimbers=64] [-SoakBoxes=2000] [-SoakSeed=1] [-SoakLongHangSeconds=3]
+ */
+UCLASS()
+class AClimbSoakGameMode : public AClimbSystemGameMode
+{
+	GENERATED_BODY()
+
+public:
+	AClimbSoakGameMode();
+
+	UPROPERTY(EditAnywhere, Category = Soak)
+	int32 NumClimbers = 64;
+
+	UPROPERTY(EditAnywhere, Category = Soak)
+	int32 NumBoxes = 2000;
+
+	UPROPERTY(EditAnywhere, Category = Soak)
+	int32 Seed = 1;
+
+	/* The soak quits after this long. Zero runs until closed*/
+	UPROPERTY(EditAnywhere, Category = Soak)
+	float SoakMinutes = 0.0f;
+
+	/* Seconds of real time in each frame time and memory sample*/
+	UPROPERTY(EditAnywhere, Category = Soak)
+	float ReportInterval = 60.0f;
+
+	/* Longest a climber may keep its input locked, a transition pending or a grab snap running*/
+	UPROPERTY(EditAnywhere, Category = Soak)
+	float MaxInputLockSeconds = 5.0f;
+
+	UPROPERTY(EditAnywhere, Category = Soak)
+	float MaxTransitionSeconds = 5.0f;
+
+	UPROPERTY(EditAnywhere, Category = Soak)
+	float MaxGrabSnapSeconds = 2.0f;
+
+	/* Seconds the bots hold one grab in four still. Longer than MaxGrabSnapSeconds, so a grab snap that never lands is caught. Zero holds none*/
+	UPROPERTY(EditAnywhere, Category = Soak)
+	float LongHangSeconds = 3.0f;
+
+	/* Allowed growth over the first sample, after warm up, before the soak reports drift*/
+	UPROPERTY(EditAnywhere, Category = Soak)
+	float MaxFrameTimeDrift = 0.25f;
+
+	UPROPERTY(EditAnywhere, Category = Soak)
+	float MaxMemoryDriftMB = 64.0f;
+
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
+	virtual void StartPlay() override;
+	virtual void Tick(float DeltaSeconds) override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+protected:
+
+	/* The bots drive ClimberPawnClass. They spawn once it is loaded and the course is built, whichever comes last*/
+	virtual void OnClimberClassLoaded() override;
+
+private:
+
+	enum class ESoakInvariant : uint8
+	{
+		HangingWhileWalking,
+		InputLeftLocked,
+		LostTransitionCallback,
+		LostGrabSnapCallback,
+		Count
+	};
+
+	UPROPERTY(Transient)
+	AClimbSoakCourse* Course;
+
+	UPROPERTY(Transient)
+	TArray<AClimbSoakBotController*> Bots;
+
+	uint32 Violations[(int32)ESoakInvariant::Count] = {};
+	int32 NumDriftReports		= 0;
+	bool bFinished				= false;
+
+	double StartRealTime		= 0.0;
+	double LastTickRealTime		= 0.0;
+	double WindowStartRealTime	= 0.0;
+	double WindowFrameSeconds	= 0.0;
+	double WindowMaxFrameSeconds = 0.0;
+	int32 WindowFrames			= 0;
+	int32 NumReports			= 0;
+	double BaselineFrameMs		= 0.0;
+	double BaselineMemoryMB		= 0.0;
+
+	FArchive* ReportFile		= nullptr;
+
+	void SpawnClimbers();
+	/* Checks every invariant for one climber, reporting and respawning it on a violation*/
+	void CheckInvariants(AClimbSoakBotController* Bot);
+	void ReportViolation(AClimbSoakBotController* Bot, ESoakInvariant Invariant);
+	/* Logs and writes one frame time and memory sample, flagging drift over the first one*/
+	void WriteReport(double Now);
+	/* Logs the totals and quits*/
+	void FinishSoak();
+	uint32 GetNumViolations() const;
+};
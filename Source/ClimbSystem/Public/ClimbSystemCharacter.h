@@ -9,13 +9,188 @@
 #include "ClimbInterface.h"
 #include "GameFramework/Character.h"
 #include "Components/ArrowComponent.h"
+#include "Animation/AnimInstance.h"
+#include "WorldCollision.h"
+#include "ClimbTelemetry.h"
+#include "ClimbLedgePath.h"
+#include "ClimbCore.h"
+#include "ClimbNavLinks.h"
+#include <type_traits>
 #include "ClimbSystemCharacter.generated.h"
 
+/* How the climb probes query the scene*/
+UENUM(BlueprintType)
+enum class EClimbProbeMode : uint8
+{
+	/* One scene query per probe*/
+	PerProbe,
+	/* One overlap gather per frame, then every probe is resolved against the gathered primitives*/
+	BroadPhase
+};
+
+/* Every scene query the climb system does while walking and hanging*/
+enum class EClimbProbe : uint8
+{
+	Forward,
+	Height,
+	JumpUp,
+	MoveRight,
+	MoveLeft,
+	JumpRight,
+	JumpLeft,
+	CornerRight,
+	CornerLeft,
+	Count
+};
+
+/* Last answer of a probe, reused while the probe quality skips frames or waits on an async query*/
+struct FClimbProbeResult
+{
+	FHitResult Hit;
+	FTraceHandle AsyncHandle;
+	uint32 Frame	= 0;
+	bool bHit		= false;
+	bool bValid		= false;
+};
+
+#if WITH_GAMEPLAY_DEBUGGER
+/* What a probe did on each of the last frames, shown by the Climb gameplay debugger category*/
+struct FClimbProbeHistory
+{
+	static const int32 NumFrames = 120;
+
+	enum EOutcome : uint8
+	{
+		NotRun,
+		Reused,
+		Missed,
+		Hit
+	};
+
+	float Microseconds[NumFrames]	= {};
+	uint8 Outcomes[NumFrames]		= {};
+};
+#endif
+
+/* Climb actions a controller can request without going through the player input bindings*/
+enum class EClimbAction : uint8
+{
+	Jump,
+	ExitClimb,
+	LeftCorner,
+	RightCorner,
+	Forward
+};
+
+DECLARE_DELEGATE_OneParam(FClimbActionDelegate, EClimbAction);
+
+/* Climb action pressed before it could run, kept for climb.InputBufferWindow seconds*/
+struct FClimbBufferedAction
+{
+	float Time			= 0.0f;
+	EClimbAction Action = EClimbAction::Jump;
+};
+
+/* Stand-ins for the animations when the climb runs without a mesh. Seconds from the start of each transition*/
+USTRUCT()
+struct FClimbSimulationTimings
+{
+	GENERATED_BODY()
+
+	/* Hanging to standing on top of the ledge*/
+	UPROPERTY(EditDefaultsOnly, Category = MeshlessClimb)
+	float ClimbLedgeTime	= ClimbCore::Rules::ClimbLedgeTime;
+
+	/* Side jump to grabbing the next ledge*/
+	UPROPERTY(EditDefaultsOnly, Category = MeshlessClimb)
+	float SideJumpTime		= ClimbCore::Rules::SideJumpTime;
+
+	/* Corner turn to the GrabLedge and EnableInput notifies*/
+	UPROPERTY(EditDefaultsOnly, Category = MeshlessClimb)
+	float CornerGrabTime	= ClimbCore::Rules::CornerGrabTime;
+
+	UPROPERTY(EditDefaultsOnly, Category = MeshlessClimb)
+	float CornerInputTime	= ClimbCore::Rules::CornerInputTime;
+
+	/* Jump up to grabbing the ledge above*/
+	UPROPERTY(EditDefaultsOnly, Category = MeshlessClimb)
+	float JumpUpTime		= ClimbCore::Rules::JumpUpTime;
+
+	/* Capsule relative PelvisSocket, used for the grab range check*/
+	UPROPERTY(EditDefaultsOnly, Category = MeshlessClimb)
+	FVector PelvisOffset	= FVector(ClimbCore::Rules::PelvisCapsuleOffset.X, ClimbCore::Rules::PelvisCapsuleOffset.Y, ClimbCore::Rules::PelvisCapsuleOffset.Z);
+};
+
+/* Animation callbacks replaced by timers when the climb runs without a mesh*/
+enum class EClimbSimulatedStep : uint8
+{
+	ClimbLedge,
+	SideJumpRight,
+	SideJumpLeft,
+	CornerRight,
+	CornerLeft,
+	CornerInput,
+	JumpUp
+};
+
+/* Animation driven transition the character is in the middle of*/
+enum class EClimbTransition : uint8
+{
+	None,
+	SideJump,
+	CornerTurn,
+	JumpUp
+};
+
+/* Everything needed to put a climber back where it was. Plain data, so it can be copied and stored freely*/
+struct FClimbSnapshot
+{
+	enum EFlags : uint16
+	{
+		Hanging				= 1 << 0,
+		TurnedBack			= 1 << 1,
+		Jumping				= 1 << 2,
+		ClimbingLedge		= 1 << 3,
+		PendingGrabLedge	= 1 << 4,
+		PendingInputEnable	= 1 << 5,
+		InputDisabled		= 1 << 6,
+		GrabSnapping		= 1 << 7
+	};
+
+	FVector Location;
+	FQuat Rotation;
+	FVector Velocity;
+	FVector WallLocation;
+	FVector WallNormal;
+	FVector WallHeightLocation;
+	/* Seconds spent hanging when the snapshot was taken*/
+	float HangTime;
+	uint16 Flags;
+	uint8 MovementMode;
+	EClimbTransition Transition;
+
+	bool HasFlag(EFlags Flag) const { return (Flags & Flag) != 0; }
+
+	bool Equals(const FClimbSnapshot& Other, float Tolerance = KINDA_SMALL_NUMBER) const
+	{
+		return Flags == Other.Flags && MovementMode == Other.MovementMode && Transition == Other.Transition
+			&& Location.Equals(Other.Location, Tolerance) && Rotation.Equals(Other.Rotation, Tolerance) && Velocity.Equals(Other.Velocity, Tolerance)
+			&& WallLocation.Equals(Other.WallLocation, Tolerance) && WallNormal.Equals(Other.WallNormal, Tolerance)
+			&& WallHeightLocation.Equals(Other.WallHeightLocation, Tolerance) && FMath::IsNearlyEqual(HangTime, Other.HangTime, Tolerance);
+	}
+};
+
+static_assert(std::is_trivially_copyable<FClimbSnapshot>::value, "FClimbSnapshot must stay plain data");
+
 UCLASS(config=Game)
-class AClimbSystemCharacter : public ACharacter, public IClimbInterface
+class CLIMBSYSTEM_API AClimbSystemCharacter : public ACharacter, public IClimbInterface
 {
 	GENERATED_BODY()
 
+#if WITH_GAMEPLAY_DEBUGGER
+	friend class FGameplayDebuggerCategory_Climb;
+#endif
+
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = Camera, meta = (AllowPrivateAccess = "true"))
 	class USpringArmComponent* CameraBoom;
 
@@ -46,6 +221,58 @@ public:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category=Camera)
 	float BaseLookUpRate;
 
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = CustomMovement)
+	EClimbProbeMode ProbeMode = EClimbProbeMode::PerProbe;
+
+	/* If the level has AClimbableVolumes, only run the climb probes inside them*/
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = CustomMovement)
+	bool bSenseOnlyInClimbableVolumes = true;
+
+	/* Average milliseconds to run all climb probes once with the given mode. Used by climb.Benchmark*/
+	double MeasureClimbProbeCost(EClimbProbeMode Mode, int32 Iterations);
+	/* Average milliseconds to record one telemetry event, into a channel of its own that no writer drains. Used by climb.Benchmark*/
+	double MeasureClimbTelemetryCost(int32 Iterations);
+
+	/* False while the character is away from climbable geometry and runs no climb probes*/
+	bool IsClimbSensingActive() const { return bClimbSensingActive; }
+	/* How many times any climber switched its sensing on since the game started*/
+	static uint32 GetClimbSensingActivations();
+
+	/* Copies the climb state into a snapshot. A handful of copies, cheap enough to call every frame*/
+	void SaveClimbSnapshot(FClimbSnapshot& OutSnapshot) const;
+	/* Puts the character back into a saved climb state. Side jumps, corner turns and jump ups that were
+	in flight land on the saved ledge straight away, since their montages can't be resumed halfway*/
+	void RestoreClimbSnapshot(const FClimbSnapshot& Snapshot);
+
+	/* Assets UClimbAssetSubsystem streams in before the character is allowed to climb*/
+	void GetClimbAssetPaths(TArray<FSoftObjectPath>& OutPaths) const;
+	/* False until the climb assets are in memory. Climb sensing stays off until then*/
+	bool AreClimbAssetsReady() const { return bClimbAssetsReady; }
+
+	/* Replaces the MoveRight axis for the climb, for controllers without player input. Kept until set again*/
+	void SetClimbMoveRightInput(float Value);
+	/* Runs an action as if its input was pressed. If it can't run yet, it is buffered and runs on the first frame it can,
+	within climb.InputBufferWindow seconds. True if it ran straight away*/
+	bool RequestClimbAction(EClimbAction Action);
+	/* True if the action would do something right now, same checks as the action itself*/
+	bool CanRunClimbAction(EClimbAction Action) const;
+
+	bool IsHanging() const { return bCharacterIsHanging; }
+	/* Runs a climb nav link through GrabLedge, the side jump or jump up, and ClimbLedge, without probing.
+	False if the character can't start it now. Drop downs are left to the path following*/
+	bool ExecuteClimbTraversal(const FClimbTraversal& Traversal);
+	/* True until the character stands on top of the last ledge of the traversal*/
+	bool IsClimbTraversalActive() const { return bClimbTraversalActive; }
+
+	/* True if the climb runs off the capsule and timing tables instead of the mesh and its animations*/
+	bool IsMeshlessClimb() const { return bMeshlessClimb; }
+	/* Seconds the climb input has been locked. Zero when it isn't*/
+	float GetClimbInputLockedTime() const;
+	/* Seconds the current transition has been waiting on its montage or latent. Zero without one*/
+	float GetPendingTransitionTime() const;
+	/* Seconds since the grab snap started without LedgeMovementFinished being called. Zero when it isn't snapping*/
+	float GetGrabSnapTime() const;
+
 protected:
 
 	UPROPERTY(BlueprintReadWrite)
@@ -60,6 +287,74 @@ protected:
 	UPROPERTY(BlueprintReadWrite)
 	bool bMovingRight;
 	
+	//*******************************************************************************************************************
+	//		PROBES                       
+	//*******************************************************************************************************************
+
+	/* Runs every climb probe and the hanging movement. Called from Tick*/
+	void UpdateClimb();
+	/* Start, end and shape of a probe for the current character transform*/
+	void GetClimbProbeQuery(EClimbProbe Probe, FVector& OutStart, FVector& OutEnd, FCollisionShape& OutShape) const;
+	/* Sweeps a probe against the LedgeTrace channel using the current ProbeMode and climb.ProbeQuality*/
+	bool ClimbProbe(EClimbProbe Probe, FHitResult& OutHit);
+#if WITH_GAMEPLAY_DEBUGGER
+	void RecordClimbProbeHistory(EClimbProbe Probe, FClimbProbeHistory::EOutcome Outcome, uint64 Cycles);
+#endif
+	/* False if climb.ActiveProbes turned the probe off*/
+	bool IsClimbProbeActive(EClimbProbe Probe) const;
+	/* Collects every LedgeTrace primitive that any probe can reach this frame*/
+	void GatherClimbCandidates();
+	/* Resolves a probe against the gathered primitives only*/
+	bool ClimbProbeAgainstCandidates(const FVector& Start, const FVector& End, const FCollisionShape& Shape, FHitResult& OutHit) const;
+
+	//*******************************************************************************************************************
+	//		MESH-LESS CLIMB                       
+	//*******************************************************************************************************************
+
+	/* PelvisSocket of the mesh, or its capsule relative stand-in without one*/
+	FVector GetClimbPelvisLocation() const;
+	/* Anim instance that takes the climb interface calls. Null without a mesh, an anim instance or the interface*/
+	UAnimInstance* GetClimbAnimListener() const;
+	/* Runs the step after Delay seconds, in place of the montage notify or anim blueprint call that would end it*/
+	void SimulateClimbStep(EClimbSimulatedStep Step, float Delay);
+	/* Moves the capsule the way the animation would have, then ends the transition*/
+	void RunSimulatedClimbStep(EClimbSimulatedStep Step);
+	/* Moves the capsule by a capsule relative offset and yaw, then re-reads the wall and ledge height in front of it*/
+	void MoveClimbCapsule(const FVector& Offset, float Yaw);
+
+	//*******************************************************************************************************************
+	//		CLIMB TRAVERSAL                       
+	//*******************************************************************************************************************
+
+	/* Next step of the traversal, called each time a grab snap finishes*/
+	void AdvanceClimbTraversal();
+
+	//*******************************************************************************************************************
+	//		PROXIMITY ACTIVATION                       
+	//*******************************************************************************************************************
+
+	/* True inside a climbable volume, in levels without volumes, or while any climb is still going on*/
+	bool ShouldSenseClimb() const;
+	/* Turns every climb probe on or off. Tick keeps running either way*/
+	void SetClimbSensingActive(bool bActive);
+	void OnClimbAssetsLoaded();
+
+	//*******************************************************************************************************************
+	//		TELEMETRY                       
+	//*******************************************************************************************************************
+
+	/* Queues an event for the telemetry thread if climb.Telemetry was on when the character began play*/
+	void RecordClimbEvent(EClimbTelemetryEvent Event, float Value = 0.0f);
+
+	//*******************************************************************************************************************
+	//		INPUT BUFFER                       
+	//*******************************************************************************************************************
+
+	void RunClimbAction(EClimbAction Action);
+	/* Runs the buffered actions that became possible, oldest first, and drops the expired ones as rejected*/
+	void ProcessClimbActionBuffer();
+	void BindClimbAction(FName ActionName, EClimbAction Action);
+
 	//*******************************************************************************************************************
 	//		CLIMB WALL                       
 	//*******************************************************************************************************************
@@ -93,6 +388,21 @@ protected:
 	void MoveCharacterOnTheSides(const bool& bMoving);
 	/* Interpolates character's position from where we are, to next target position in wall*/
 	void MoveInLedge();
+
+	/* Starts the ledge path from the wall and ledge height the character grabbed*/
+	void ExtractLedgePath();
+	/* Forgets the ledge path. Called whenever the character leaves the ledge it was extracted from*/
+	void ResetLedgePath();
+	/* Probes the next edge point past the end of the path on that side. False where the ledge ends, bends or steps*/
+	bool ExtendLedgePath(bool bRight);
+	/* Extends the path one step past the character on that side. False if there is no ledge left that way*/
+	bool EnsureLedgePath(bool bRight);
+	/* Shimmies along the ledge path, facing the wall at every point of it*/
+	void MoveAlongLedgePath(bool bRight);
+	/* Sweeps the probe sphere against the LedgeTrace channel. Used by the ledge path*/
+	bool LedgePathProbe(const FVector& Start, const FVector& End, FHitResult& OutHit) const;
+	/* While true the ledge path owns the wall and ledge the character hangs from, the forward and height probes don't move them*/
+	bool IsFollowingLedgePath() const { return bCharacterIsHanging && LedgePath.IsValid(); }
 	
 	//*******************************************************************************************************************
 	//		JUMP                         
@@ -100,30 +410,56 @@ protected:
 	
 	/* Checks the Left and Right Tracers on the Tick*/
 	void CheckForJumpOnTheSides();
-	/* Creates two capsule collisions from the Ledge Arrow components to check if we can jump*/
-	void JumpRightLeftTracer(const bool& bRight);
+	/* Creates two capsule collisions from the Ledge Arrow components to check if there is a wall to jump to*/
+	bool JumpRightLeftTracer(const bool& bRight);
 	/* Sets some variables when the Animator blueprint stops the montage*/
 	void JumpRight_Implementation(bool bJumpRight) override;
 	/* Sets some variables when the Animator blueprint stops the montage*/
 	void JumpLeft_Implementation(bool bJumpLeft) override;
 	/*Called from CheckJump. This function actually makes the player jumps to the side wall
-	It has a LatenInfo that after a Delay function, it calls the GrabLedge function.*/
-	void JumpRightLeftLedge(const bool& bRight);	
+	The jump montage calls GrabLedge through its GrabLedge notify, or when it blends out.*/
+	void JumpRightLeftLedge(const bool& bRight);
+	/* Starts the side jump without checking the input*/
+	void StartSideJump(bool bRight);	
 	
 	//*******************************************************************************************************************
 	//		CORNER DETECTION                        
 	//*******************************************************************************************************************
 	
-	/* Creates two Sphere collisions from the Right/Left Arrow components to check if we can turn around the corner.*/
-	void TurnCornerRightLeftTracer(const bool& bRight);
+	/* Creates two Sphere collisions from the Right/Left Arrow components. No hit means we can turn around the corner.*/
+	bool TurnCornerRightLeftTracer(const bool& bRight);
 	/* Turns Left the corner and play an Animation Montage.*/
 	void TurnToWallLeftCorner();
 	/* Turns Right the corner and play an Animation Montage.*/
 	void TurnToWallRightCorner();
-	/* Enables player's Input after turn around the corner. Used in LatentInfo*/
+	/* Disables input and plays the corner montage. GrabLedge and EnablePlayerInputs are driven by its notifies, or by timers without a mesh*/
+	void TurnCorner(bool bRight);
+	/* Enables player's Input after turn around the corner. Called from the montage EnableInput notify*/
 	UFUNCTION(BlueprintCallable)
 	void EnablePlayerInputs();
 
+	//*******************************************************************************************************************
+	//		ANIMATION DRIVEN TRANSITIONS                       
+	//*******************************************************************************************************************
+
+	/* Resolves pending transitions when a montage reaches a GrabLedge or EnableInput Play Montage Notify*/
+	UFUNCTION()
+	void OnClimbMontageNotifyBegin(FName NotifyName, const FBranchingPointNotifyPayload& BranchingPointPayload);
+	/* The first montage that starts while a transition is pending is taken as that transition's montage*/
+	UFUNCTION()
+	void OnClimbMontageStarted(UAnimMontage* Montage);
+	/* Resolves whatever is still pending when the transition montage blends out (montages without notifies).
+	Other montages are ignored*/
+	UFUNCTION()
+	void OnClimbMontageBlendingOut(UAnimMontage* Montage, bool bInterrupted);
+	/* Grabs the ledge and re-enables input if the animation didn't do it already*/
+	void FinishPendingClimbTransitions();
+	/* Ends the transition in flight on the ledge it was going to. Only the GrabLedge notify, the blend out fallback,
+	the simulated steps and a restore land a transition, the per frame grab never does*/
+	void LandClimbTransition();
+	/* True from the start of a side jump, corner turn or jump up until it lands*/
+	bool IsClimbTransitionInFlight() const { return bIsJumping || bPendingGrabLedge || ActiveTransition != EClimbTransition::None; }
+
 	//*******************************************************************************************************************
 	//		JUMP UP                       
 	//*******************************************************************************************************************
@@ -132,6 +468,8 @@ protected:
 	void JumpUpTracer();
 	/* Creates a capsule collision from the Up Arrow components to check if we can jump Up*/
 	void JumpUpLedge();
+	/* Starts the jump up without checking the input or the up probe*/
+	void StartJumpUp();
 	/* Calls the AnimBlueprint interface JumpUp to make the Jump*/
 	void JumpUp_Implementation(bool bJumpUp) override;
 
@@ -153,24 +491,105 @@ protected:
 	virtual void SetupPlayerInputComponent(class UInputComponent* PlayerInputComponent) override;
 	virtual void Tick( float DeltaSeconds ) override;
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+	virtual void UnPossessed() override;
+	virtual void NotifyActorBeginOverlap(AActor* OtherActor) override;
+	virtual void NotifyActorEndOverlap(AActor* OtherActor) override;
 
 private:
 
+	/* Soft so they are only loaded by UClimbAssetSubsystem, once for every climber of the class*/
+	UPROPERTY(EditDefaultsOnly, Category = AnimMontages)
+	TSoftObjectPtr<UAnimMontage> CornerLeftMontage;
+
 	UPROPERTY(EditDefaultsOnly, Category = AnimMontages)
-	UAnimMontage* CornerLeftMontage;
+	TSoftObjectPtr<UAnimMontage> CornerRightMontage;
 
+	/* Montage of the side jump or corner turn in flight. Null until it starts, or when the transition has none*/
+	UPROPERTY(Transient)
+	UAnimMontage* ClimbTransitionMontage;
+
+	/* Play Montage Notify name that snaps the character to the new ledge during corner turns and side jumps*/
+	UPROPERTY(EditDefaultsOnly, Category = AnimMontages)
+	FName GrabLedgeNotifyName = FName("GrabLedge");
+
+	/* Play Montage Notify name that gives the input back to the player during corner turns*/
 	UPROPERTY(EditDefaultsOnly, Category = AnimMontages)
-	UAnimMontage* CornerRightMontage;
+	FName EnableInputNotifyName = FName("EnableInput");
 
 	USkeletalMeshComponent* MyCharacterMesh;
 
+	/* Used instead of the animations when the climb runs without a mesh, see climb.MeshlessClimb*/
+	UPROPERTY(EditDefaultsOnly, Category = MeshlessClimb)
+	FClimbSimulationTimings SimulationTimings;
+
+	TArray<FTimerHandle, TInlineAllocator<2>> SimulatedStepTimers;
+	bool bMeshlessClimb					= false;
+
+	FClimbTraversal ActiveClimbTraversal;
+	bool bClimbTraversalActive			= false;
+	/* The side jump or jump up of the traversal has started*/
+	bool bClimbTraversalLanded			= false;
+
+	/* Climb action bindings. Pushed onto the controller on their own, so DisableInput doesn't drop presses the buffer should keep*/
+	UPROPERTY(Transient)
+	UInputComponent* ClimbActionInput;
+
+	TArray<FClimbBufferedAction, TInlineAllocator<8>> ClimbActionBuffer;
+
+	/* Primitives gathered by GatherClimbCandidates. Only valid during the frame they were gathered*/
+	TArray<UPrimitiveComponent*> ClimbCandidates;
+	TArray<FOverlapResult> ClimbOverlaps;
+
+	/* Built once in BeginPlay. They ignore the character and tag each query for the scene query stats*/
+	FCollisionQueryParams ClimbProbeQueryParams;
+	FCollisionQueryParams LedgePathQueryParams;
+	FCollisionQueryParams BroadPhaseQueryParams;
+	/* Answers of the async probes are copied here, so the hit array keeps its memory between frames*/
+	FTraceDatum AsyncProbeDatum;
+
+	FClimbProbeResult ProbeResults[(int32)EClimbProbe::Count];
+#if WITH_GAMEPLAY_DEBUGGER
+	FClimbProbeHistory ProbeHistory[(int32)EClimbProbe::Count];
+#endif
+	uint32 ClimbProbeFrame = 0;
+
 	FVector WallLocation;
 	FVector WallNormal;
 	FVector WallHeightLocation;
 
+	FClimbLedgePath LedgePath;
+	float LedgePathDistance				= 0.0f;
+	bool bLedgePathFailed				= false;
+
+	FClimbTelemetryChannelPtr ClimbTelemetry;
+	float LedgeContactTime				= -1.0f;
+	float HangStartTime					= 0.0f;
+	float TransitionStartTime			= 0.0f;
+	float InputLockStartTime			= 0.0f;
+	float GrabSnapStartTime				= 0.0f;
+	int32 GrabSnapUUID					= 0;
+	/* Target of the snap in flight*/
+	FVector GrabSnapLocation			= FVector::ZeroVector;
+	FRotator GrabSnapRotation			= FRotator::ZeroRotator;
+
+	float ClimbMoveRightInput			= 0.0f;
+	bool bHasClimbMoveRightInput		= false;
+
+	bool bClimbAssetsReady				= true;
+
+	int32 OverlappingClimbableVolumes	= 0;
+	bool bClimbSensingGated				= false;
+	bool bClimbSensingActive			= true;
+
 	bool bCharacterIsHanging	= false;
 	bool bTurnedBack			= false;
 	bool bIsJumping				= false;
+	bool bPendingGrabLedge		= false;
+	bool bPendingInputEnable	= false;
+	bool bClimbInputDisabled	= false;
+	bool bGrabSnapping			= false;
+	EClimbTransition ActiveTransition = EClimbTransition::None;
 	bool bIsClimbingLedge;
 	bool bCanJumpUp;
 	bool bCanJumpLeft;
@@ -178,11 +597,13 @@ private:
 	bool bCanTurnLeft;
 	bool bCanTurnRight;
 
-	const float moveSidesSpeed	= 17.0f;
-
 	const int32 maxUUIDValues	= 25;
 	int32 currentUUIDValue		= -1;
 	
+	/* MoveRight axis of the player, or the one set by SetClimbMoveRightInput*/
+	float GetClimbMoveRightInput() const;
+	/* Climb action input of the player. Goes through RequestClimbAction like any controller*/
+	void OnClimbActionPressed(EClimbAction Action);
 	/* Checks if it should do a Normal Jump, a Jump on the sides or climb when we press the Jump Input*/
 	void CheckForJump();
 	/* Checks if it should turn back or fall down*/
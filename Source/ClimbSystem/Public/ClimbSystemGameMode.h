@@ -13,7 +13,29 @@ class AClimbSystemGameMode : public AGameModeBase
 
 public:
 	AClimbSystemGameMode();
-};
 
+	/* Climber pawn, streamed in with its climb assets when the game starts instead of with the game mode*/
+	UPROPERTY(EditAnywhere, Category = Classes)
+	TSoftClassPtr<APawn> ClimberPawnClass;
+
+	virtual void InitGame(const FString& MapName, const FString& Options, FString& ErrorMessage) override;
+	virtual void HandleStartingNewPlayer_Implementation(APlayerController* NewPlayer) override;
+
+protected:
+
+	/* If false the climber class is only loaded, and DefaultPawnClass is left alone*/
+	bool bClimberIsDefaultPawn = true;
 
+	bool IsClimberClassLoaded() const { return bClimberClassLoaded; }
+	/* Null until OnClimberClassLoaded*/
+	UClass* GetLoadedClimberClass() const { return ClimberPawnClass.Get(); }
+	virtual void OnClimberClassLoaded();
 
+private:
+
+	/* Players that joined before the climber class was loaded*/
+	UPROPERTY(Transient)
+	TArray<APlayerController*> WaitingPlayers;
+
+	bool bClimberClassLoaded = false;
+};
@@ -0,0 +1,79 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/CircularQueue.h"
+#include "HAL/ThreadSafeBool.h"
+#include "HAL/ThreadSafeCounter.h"
+
+enum class EClimbTelemetryEvent : uint8
+{
+	LedgeContact,
+	Grab,
+	MissedGrab,
+	HangStart,
+	HangEnd,
+	SideJumpStart,
+	SideJumpLanded,
+	CornerTurnStart,
+	CornerTurnFinished,
+	InputRejected,
+	Count
+};
+
+/* One climb event. Value is the grab latency for Grab and the hanging time for HangEnd*/
+struct FClimbTelemetryRecord
+{
+	float Time		= 0.0f;
+	float Value		= 0.0f;
+	EClimbTelemetryEvent Event = EClimbTelemetryEvent::LedgeContact;
+};
+
+/* Single producer, single consumer queue of events for one climber. The game thread writes, the telemetry thread drains*/
+class CLIMBSYSTEM_API FClimbTelemetryChannel
+{
+public:
+
+	FClimbTelemetryChannel(const FString& InClimberName, uint32 Capacity);
+
+	/* Game thread only. Never blocks or allocates; the record is counted as dropped if the queue is full*/
+	FORCEINLINE void Record(EClimbTelemetryEvent Event, float Time, float Value = 0.0f)
+	{
+		FClimbTelemetryRecord NewRecord;
+		NewRecord.Time	= Time;
+		NewRecord.Value = Value;
+		NewRecord.Event = Event;
+
+		if (!Queue.Enqueue(NewRecord))
+			DroppedRecords.Increment();
+	}
+
+private:
+
+	friend class FClimbTelemetry;
+	friend class FClimbTelemetryWriter;
+
+	FString ClimberName;
+	TCircularQueue<FClimbTelemetryRecord> Queue;
+	FThreadSafeCounter DroppedRecords;
+	FThreadSafeBool bClosed;
+};
+
+typedef TSharedPtr<FClimbTelemetryChannel, ESPMode::ThreadSafe> FClimbTelemetryChannelPtr;
+
+/* Entry point for climbers. Events are flushed to Saved/Telemetry/Climb_<Date>.csv by a background thread*/
+class CLIMBSYSTEM_API FClimbTelemetry
+{
+public:
+
+	/* climb.Telemetry console variable*/
+	static bool IsEnabled();
+	/* Starts the writer thread the first time it is called. Null if the telemetry file can't be written*/
+	static FClimbTelemetryChannelPtr OpenChannel(const FString& ClimberName);
+	/* The writer drains what is left in the channel and then forgets it*/
+	static void CloseChannel(const FClimbTelemetryChannelPtr& Channel);
+};
@@ -0,0 +1,21 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Volume.h"
+#include "ClimbableVolume.generated.h"
+
+/* Coarse region around climbable geometry. Once a level has one of these, climbers only run
+their probes while they overlap a volume (or are in the middle of a climb).*/
+UCLASS()
+class AClimbableVolume : public AVolume
+{
+	GENERATED_BODY()
+
+public:
+	AClimbableVolume();
+};
@@ -0,0 +1,59 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#if WITH_GAMEPLAY_DEBUGGER
+
+#include "GameplayDebuggerCategory.h"
+
+class AClimbSystemCharacter;
+class APlayerController;
+
+/* Climb probes of the selected climber, player or AI. Draws each probe with its last answer and lists
+its cost and hit rate over the last frames, next to the climb state and the transition in flight*/
+class FGameplayDebuggerCategory_Climb : public FGameplayDebuggerCategory
+{
+public:
+
+	FGameplayDebuggerCategory_Climb();
+
+	virtual void CollectData(APlayerController* OwnerPC, AActor* DebugActor) override;
+	virtual void DrawData(APlayerController* OwnerPC, FGameplayDebuggerCanvasContext& CanvasContext) override;
+
+	static TSharedRef<FGameplayDebuggerCategory> MakeInstance();
+
+protected:
+
+	struct FProbeStats
+	{
+		float MicrosecondsPerFrame	= 0.0f;
+		float MaxMicroseconds		= 0.0f;
+		uint16 NumRun				= 0;
+		uint16 NumReused			= 0;
+		uint16 NumHits				= 0;
+		bool bActive				= false;
+		bool bLastHit				= false;
+	};
+
+	struct FRepData
+	{
+		FString ClimberName;
+		FString StateDesc;
+		FString OptionsDesc;
+		FString TransitionDesc;
+		TArray<FProbeStats> Probes;
+
+		void Serialize(FArchive& Ar);
+	};
+
+	FRepData DataPack;
+
+	void CollectProbe(const AClimbSystemCharacter& Climber, int32 Probe);
+};
+
+#endif
@@ -9,6 +9,6 @@ public class ClimbSystemEditorTarget : TargetRules
 	{
 		Type = TargetType.Editor;
 		DefaultBuildSettings = BuildSettingsVersion.V2;
-		ExtraModuleNames.Add("ClimbSystem");
+		ExtraModuleNames.AddRange( new string[] { "ClimbSystem", "ClimbSystemTools" } );
 	}
 }
@@ -0,0 +1,8 @@
+// Copyright 1998-2019 Epic Games, Inc. All Rights Reserved.
+
+#include "ClimbSystemTools.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY(LogClimbTools);
+
+IMPLEMENT_MODULE( FDefaultModuleImpl, ClimbSystemTools );
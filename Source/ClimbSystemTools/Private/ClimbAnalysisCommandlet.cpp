@@ -0,0 +1,253 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbAnalysisCommandlet.h"
+#include "ClimbSystemTools.h"
+#include "ClimbLedgeScanner.h"
+#include "ClimbSystemCharacter.h"
+#include "Async/ParallelFor.h"
+#include "Components/CapsuleComponent.h"
+#include "Dom/JsonObject.h"
+#include "Engine/LevelStreaming.h"
+#include "Engine/World.h"
+#include "GameFramework/CharacterMovementComponent.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/PackageName.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+#include "UObject/Package.h"
+
+//Cells per side of the probe cost heatmap, at most.
+static const int32 MaxHeatmapCells = 4096;
+
+UClimbAnalysisCommandlet::UClimbAnalysisCommandlet()
+{
+	IsClient		= false;
+	IsEditor		= true;
+	IsServer		= false;
+	LogToConsole	= true;
+}
+
+int32 UClimbAnalysisCommandlet::Main(const FString& Params)
+{
+	FString MapName;
+	if (!FParse::Value(*Params, TEXT("Map="), MapName) || !FPackageName::IsValidLongPackageName(MapName))
+	{
+		UE_LOG(LogClimbTools, Error, TEXT("ClimbAnalysis: pass a map long package name with -Map=/Game/..."));
+		return 1;
+	}
+
+	FString OutputDir = FPaths::ProjectSavedDir() / TEXT("ClimbAnalysis");
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+
+	float SampleSpacing = 50.0f;
+	float CellSize		= 400.0f;
+	FParse::Value(*Params, TEXT("Spacing="), SampleSpacing);
+	FParse::Value(*Params, TEXT("CellSize="), CellSize);
+
+	TSubclassOf<AClimbSystemCharacter> PawnClass = AClimbSystemCharacter::StaticClass();
+	FString PawnClassPath;
+	if (FParse::Value(*Params, TEXT("PawnClass="), PawnClassPath))
+	{
+		PawnClass = LoadClass<AClimbSystemCharacter>(nullptr, *PawnClassPath);
+		if (!PawnClass)
+		{
+			UE_LOG(LogClimbTools, Error, TEXT("ClimbAnalysis: %s is not an AClimbSystemCharacter class"), *PawnClassPath);
+			return 1;
+		}
+	}
+
+	UPackage* MapPackage	= LoadPackage(nullptr, *MapName, LOAD_None);
+	UWorld* World			= MapPackage ? UWorld::FindWorldInPackage(MapPackage) : nullptr;
+	if (!World)
+	{
+		UE_LOG(LogClimbTools, Error, TEXT("ClimbAnalysis: could not load %s"), *MapName);
+		return 1;
+	}
+
+	World->AddToRoot();
+	World->WorldType = EWorldType::Editor;
+
+	if (!World->bIsWorldInitialized)
+	{
+		World->InitWorld(UWorld::InitializationValues()
+			.AllowAudioPlayback(false)
+			.CreatePhysicsScene(true)
+			.RequiresHitProxies(false)
+			.CreateNavigation(false)
+			.CreateAISystem(false)
+			.ShouldSimulatePhysics(false)
+			.SetTransactional(false));
+	}
+
+	for (ULevelStreaming* StreamingLevel : World->GetStreamingLevels())
+	{
+		StreamingLevel->SetShouldBeLoaded(true);
+		StreamingLevel->SetShouldBeVisible(true);
+	}
+
+	World->FlushLevelStreaming(EFlushLevelStreamingType::Full);
+	World->UpdateWorldComponents(true, false);
+
+	const AClimbSystemCharacter* DefaultCharacter = PawnClass->GetDefaultObject<AClimbSystemCharacter>();
+
+	FClimbReachSettings ReachSettings;
+	ReachSettings.CapsuleRadius		= DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleRadius();
+	ReachSettings.CapsuleHalfHeight = DefaultCharacter->GetCapsuleComponent()->GetUnscaledCapsuleHalfHeight();
+	ReachSettings.JumpZVelocity		= DefaultCharacter->GetCharacterMovement()->JumpZVelocity;
+	ReachSettings.GravityZ			= World->GetGravityZ();
+
+	const double ScanStartTime = FPlatformTime::Seconds();
+
+	FClimbLedgeScanner Scanner(World, ReachSettings, SampleSpacing);
+	Scanner.GatherPrimitives();
+	Scanner.ScanLedges();
+
+	const double ScanSeconds	= FPlatformTime::Seconds() - ScanStartTime;
+	const FString BaseName		= OutputDir / FPackageName::GetShortName(MapName);
+
+	UE_LOG(LogClimbTools, Display, TEXT("ClimbAnalysis: %d LedgeTrace primitives, %d ledge samples in %.2f s"),
+		Scanner.GetPrimitives().Num(), Scanner.GetSamples().Num(), ScanSeconds);
+
+	const bool bWritten =	WriteLedgesCSV(Scanner, BaseName + TEXT("_Ledges.csv")) &&
+							WriteProbeCostHeatmap(Scanner, FMath::Max(CellSize, 50.0f), BaseName + TEXT("_ProbeCost")) &&
+							WriteSummaryJSON(Scanner, MapName, ScanSeconds, BaseName + TEXT("_Climbability.json"));
+
+	World->CleanupWorld();
+	World->RemoveFromRoot();
+	CollectGarbage(RF_NoFlags);
+
+	if (!bWritten)
+	{
+		UE_LOG(LogClimbTools, Error, TEXT("ClimbAnalysis: could not write the report to %s"), *OutputDir);
+		return 1;
+	}
+
+	UE_LOG(LogClimbTools, Display, TEXT("ClimbAnalysis: report written to %s"), *OutputDir);
+	return 0;
+}
+
+bool UClimbAnalysisCommandlet::WriteLedgesCSV(const FClimbLedgeScanner& Scanner, const FString& FilePath) const
+{
+	TArray<FString> Lines;
+	Lines.Reserve(Scanner.GetSamples().Num() + 1);
+	Lines.Add(TEXT("X,Y,Z,NormalX,NormalY,FloorZ,Grabbable,ForwardProbeHit,HeightProbeHit,InJumpReach,CanMoveRight,CanMoveLeft,CanJumpRight,CanJumpLeft,CanJumpUp,NearbyPrimitives"));
+
+	for (const FClimbLedgeSample& Sample : Scanner.GetSamples())
+	{
+		Lines.Add(FString::Printf(TEXT("%.1f,%.1f,%.1f,%.3f,%.3f,%.1f,%d,%d,%d,%d,%d,%d,%d,%d,%d,%d"),
+			Sample.LedgeLocation.X, Sample.LedgeLocation.Y, Sample.LedgeLocation.Z,
+			Sample.WallNormal.X, Sample.WallNormal.Y, Sample.FloorHeight,
+			Sample.bGrabbable, Sample.bForwardProbeHit, Sample.bHeightProbeHit, Sample.bInJumpReach,
+			Sample.bCanMoveRight, Sample.bCanMoveLeft, Sample.bCanJumpRight, Sample.bCanJumpLeft, Sample.bCanJumpUp,
+			Sample.NearbyPrimitives));
+	}
+
+	return FFileHelper::SaveStringArrayToFile(Lines, *FilePath);
+}
+
+bool UClimbAnalysisCommandlet::WriteProbeCostHeatmap(const FClimbLedgeScanner& Scanner, float CellSize, const FString& FilePath) const
+{
+	const FBox WorldBounds = Scanner.GetPrimitivesBounds();
+	if (!WorldBounds.IsValid)
+		return FFileHelper::SaveStringToFile(TEXT("CellX,CellY,MinX,MinY,Primitives\n"), *(FilePath + TEXT(".csv")));
+
+	//Large maps get bigger cells instead of losing their far side to the bitmap size limit.
+	const float LongestSide = FMath::Max(WorldBounds.Max.X - WorldBounds.Min.X, WorldBounds.Max.Y - WorldBounds.Min.Y);
+	if (LongestSide / CellSize > MaxHeatmapCells)
+	{
+		const float FittedCellSize = LongestSide / MaxHeatmapCells;
+
+		UE_LOG(LogClimbTools, Warning, TEXT("ClimbAnalysis: %.0f cm cells would need more than %d cells per side, using %.0f cm cells"),
+			CellSize, MaxHeatmapCells, FittedCellSize);
+
+		CellSize = FittedCellSize;
+	}
+
+	const int32 CellsX = FMath::Clamp(FMath::CeilToInt((WorldBounds.Max.X - WorldBounds.Min.X) / CellSize), 1, MaxHeatmapCells);
+	const int32 CellsY = FMath::Clamp(FMath::CeilToInt((WorldBounds.Max.Y - WorldBounds.Min.Y) / CellSize), 1, MaxHeatmapCells);
+
+	TArray<int32> CellCosts;
+	CellCosts.SetNumZeroed(CellsX * CellsY);
+
+	//A climber anywhere in the cell sweeps against every primitive within probe reach of it.
+	ParallelFor(CellCosts.Num(), [&](int32 CellIndex)
+	{
+		const FVector CellMin(WorldBounds.Min.X + (CellIndex % CellsX) * CellSize, WorldBounds.Min.Y + (CellIndex / CellsX) * CellSize, WorldBounds.Min.Z);
+		const FVector CellMax(CellMin.X + CellSize, CellMin.Y + CellSize, WorldBounds.Max.Z);
+
+		CellCosts[CellIndex] = Scanner.CountPrimitivesInBox(FBox(CellMin, CellMax).ExpandBy(FClimbLedgeScanner::ProbeReach));
+	});
+
+	const int32 MaxCost = FMath::Max(1, FMath::Max(CellCosts));
+
+	TArray<FString> Lines;
+	Lines.Reserve(CellCosts.Num() + 1);
+	Lines.Add(TEXT("CellX,CellY,MinX,MinY,Primitives"));
+
+	TArray<FColor> Pixels;
+	Pixels.SetNumUninitialized(CellCosts.Num());
+
+	for (int32 CellIndex = 0; CellIndex < CellCosts.Num(); CellIndex++)
+	{
+		const int32 CellX = CellIndex % CellsX;
+		const int32 CellY = CellIndex / CellsX;
+
+		Lines.Add(FString::Printf(TEXT("%d,%d,%.1f,%.1f,%d"), CellX, CellY,
+			WorldBounds.Min.X + CellX * CellSize, WorldBounds.Min.Y + CellY * CellSize, CellCosts[CellIndex]));
+
+		const uint8 Heat		= (uint8)FMath::RoundToInt(255.0f * CellCosts[CellIndex] / MaxCost);
+		Pixels[CellIndex]		= FColor(Heat, 0, 255 - Heat);
+	}
+
+	return	FFileHelper::SaveStringArrayToFile(Lines, *(FilePath + TEXT(".csv"))) &&
+			FFileHelper::CreateBitmap(*(FilePath + TEXT(".bmp")), CellsX, CellsY, Pixels.GetData());
+}
+
+bool UClimbAnalysisCommandlet::WriteSummaryJSON(const FClimbLedgeScanner& Scanner, const FString& MapName, double ScanSeconds, const FString& FilePath) const
+{
+	int32 Grabbable			= 0;
+	int32 ForwardMisses		= 0;
+	int32 HeightMisses		= 0;
+	int32 OutOfReach		= 0;
+	int32 SideJumps			= 0;
+	int32 JumpUps			= 0;
+	int32 MaxNearby			= 0;
+	int64 TotalNearby		= 0;
+
+	for (const FClimbLedgeSample& Sample : Scanner.GetSamples())
+	{
+		Grabbable		+= Sample.bGrabbable ? 1 : 0;
+		ForwardMisses	+= Sample.bForwardProbeHit ? 0 : 1;
+		HeightMisses	+= Sample.bHeightProbeHit ? 0 : 1;
+		OutOfReach		+= Sample.bInJumpReach ? 0 : 1;
+		SideJumps		+= (Sample.bCanJumpRight ? 1 : 0) + (Sample.bCanJumpLeft ? 1 : 0);
+		JumpUps			+= Sample.bCanJumpUp ? 1 : 0;
+		MaxNearby		= FMath::Max(MaxNearby, Sample.NearbyPrimitives);
+		TotalNearby		+= Sample.NearbyPrimitives;
+	}
+
+	const int32 NumSamples = Scanner.GetSamples().Num();
+
+	TSharedRef<FJsonObject> Summary = MakeShared<FJsonObject>();
+	Summary->SetStringField(TEXT("map"),						MapName);
+	Summary->SetNumberField(TEXT("scanSeconds"),				ScanSeconds);
+	Summary->SetNumberField(TEXT("ledgeTracePrimitives"),		Scanner.GetPrimitives().Num());
+	Summary->SetNumberField(TEXT("ledgeSamples"),				NumSamples);
+	Summary->SetNumberField(TEXT("grabbable"),					Grabbable);
+	Summary->SetNumberField(TEXT("forwardProbeMisses"),			ForwardMisses);
+	Summary->SetNumberField(TEXT("heightProbeMisses"),			HeightMisses);
+	Summary->SetNumberField(TEXT("outOfJumpReach"),				OutOfReach);
+	Summary->SetNumberField(TEXT("sideJumpTargets"),			SideJumps);
+	Summary->SetNumberField(TEXT("jumpUpTargets"),				JumpUps);
+	Summary->SetNumberField(TEXT("maxPrimitivesPerProbe"),		MaxNearby);
+	Summary->SetNumberField(TEXT("averagePrimitivesPerProbe"),	NumSamples > 0 ? (double)TotalNearby / NumSamples : 0.0);
+
+	FString JsonText;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonText);
+
+	return FJsonSerializer::Serialize(Summary, Writer) && FFileHelper::SaveStringToFile(JsonText, *FilePath);
+}
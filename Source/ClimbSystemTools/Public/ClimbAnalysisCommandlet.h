@@ -0,0 +1,38 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "ClimbAnalysisCommandlet.generated.h"
+
+class FClimbLedgeScanner;
+
+/*
+ * Headless climbability report for a map.
+ * UE4Editor-Cmd ClimbSystem.uproject -run=ClimbAnalysis -Map=/Game/ThirdPersonCPP/Maps/ThirdPersonExampleMap
+ *		[-PawnClass=/Game/ThirdPersonCPP/Blueprints/ThirdPersonCharacter.ThirdPersonCharacter_C]
+ *		[-Output=<Dir>] [-Spacing=50] [-CellSize=400] -nullrhi -unattended
+ */
+UCLASS()
+class UClimbAnalysisCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UClimbAnalysisCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+
+	/* One row per ledge sample with the result of every probe*/
+	bool WriteLedgesCSV(const FClimbLedgeScanner& Scanner, const FString& FilePath) const;
+	/* Grid of primitives each hanging probe would have to consider, as CSV and bitmap*/
+	bool WriteProbeCostHeatmap(const FClimbLedgeScanner& Scanner, float CellSize, const FString& FilePath) const;
+	/* Totals for the whole map*/
+	bool WriteSummaryJSON(const FClimbLedgeScanner& Scanner, const FString& MapName, double ScanSeconds, const FString& FilePath) const;
+};
@@ -0,0 +1,75 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbCore.h"
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace ClimbCore;
+
+//Results go here so the optimizer can't drop the calls.
+static volatile float FloatSink	= 0.0f;
+static volatile int IntSink		= 0;
+
+template <typename FunctionType>
+static void RunBenchmark(const char* Name, long Iterations, FunctionType Function)
+{
+	const auto StartTime = std::chrono::steady_clock::now();
+
+	for (long Iteration = 0; Iteration < Iterations; Iteration++)
+		Function(Iteration);
+
+	const auto EndTime = std::chrono::steady_clock::now();
+	const double Nanoseconds = std::chrono::duration<double, std::nano>(EndTime - StartTime).count();
+
+	std::printf("%-22s %8.2f ns/call\n", Name, Nanoseconds / (Iterations > 0 ? Iterations : 1));
+}
+
+int main(int argc, char** argv)
+{
+	const long Iterations = argc > 1 ? std::atol(argv[1]) : 10000000;
+
+	std::printf("ClimbCore, %ld calls each\n", Iterations);
+
+	//Inputs change with the iteration so every call does the work.
+	RunBenchmark("ComputeGrabTarget", Iterations, [](long Iteration)
+	{
+		FGrabInput Input;
+		Input.WallLocation	= { (float)(Iteration & 1023), 20.0f, 50.0f };
+		Input.WallNormal	= { -0.8f, (Iteration & 1) ? 0.6f : -0.6f, 0.0f };
+		Input.LedgeHeight	= 200.0f;
+
+		const FGrabTarget Target = ComputeGrabTarget(Input);
+		FloatSink = Target.Location.X + Target.Rotation.Yaw;
+	});
+
+	RunBenchmark("IsPelvisInGrabRange", Iterations, [](long Iteration)
+	{
+		IntSink = IsPelvisInGrabRange((float)(Iteration & 127) + 120.0f, 200.0f);
+	});
+
+	RunBenchmark("DecideJumpAction", Iterations, [](long Iteration)
+	{
+		FJumpInput Input;
+		Input.bIsHanging	= (Iteration & 1) != 0;
+		Input.bTurnedBack	= (Iteration & 2) != 0;
+		Input.bIsJumping	= (Iteration & 4) != 0;
+		Input.bCanJumpRight	= (Iteration & 8) != 0;
+		Input.bCanJumpLeft	= (Iteration & 16) != 0;
+		Input.bCanJumpUp	= (Iteration & 32) != 0;
+		Input.MoveRightAxis	= (float)((Iteration >> 6) % 3) - 1.0f;
+
+		IntSink = (int)DecideJumpAction(Input);
+	});
+
+	RunBenchmark("EvaluateSide", Iterations, [](long Iteration)
+	{
+		const FSideOptions Options = EvaluateSide((Iteration & 1) != 0, (Iteration & 2) != 0, (Iteration & 4) != 0);
+		IntSink = Options.bCanJump + Options.bCanTurn * 2;
+	});
+
+	return 0;
+}
@@ -0,0 +1,199 @@
+//+---------------------------------------------------------+
+//| Project   : MedelDesign Climb System C++ UE 4.24		|
+//| Author    : github.com/LordWake					 		|
+//+---------------------------------------------------------+
+
+#include "ClimbCore.h"
+#include <cmath>
+#include <cstdio>
+
+using namespace ClimbCore;
+
+static int NumChecks	= 0;
+static int NumFailures	= 0;
+
+#define CLIMB_CHECK(Condition)																\
+	do																						\
+	{																						\
+		NumChecks++;																		\
+		if (!(Condition))																	\
+		{																					\
+			NumFailures++;																	\
+			std::printf("%s:%d: failed: %s\n", __FILE__, __LINE__, #Condition);				\
+		}																					\
+	} while (0)
+
+static bool NearlyEqual(float A, float B, float Tolerance = 0.01f)
+{
+	return std::fabs(A - B) <= Tolerance;
+}
+
+//Same angle, whatever the winding.
+static bool SameAngle(float A, float B)
+{
+	const float Delta = std::fmod(std::fabs(A - B), 360.0f);
+	return Delta < 0.01f || Delta > 359.99f;
+}
+
+static FJumpInput Hanging()
+{
+	FJumpInput Input;
+	Input.bIsHanging = true;
+	return Input;
+}
+
+//*******************************************************************************************************************
+//		GRAB
+//*******************************************************************************************************************
+
+static void TestComputeGrabTarget()
+{
+	//Wall in front along +X, its normal facing back at the character.
+	FGrabInput Input;
+	Input.WallLocation	= { 100.0f, 20.0f, 50.0f };
+	Input.WallNormal	= { -1.0f, 0.0f, 0.0f };
+	Input.LedgeHeight	= 200.0f;
+
+	FGrabTarget Target = ComputeGrabTarget(Input);
+
+	CLIMB_CHECK(NearlyEqual(Target.Location.X, 100.0f - Rules::HangWallOffset));
+	CLIMB_CHECK(NearlyEqual(Target.Location.Y, 20.0f));
+	CLIMB_CHECK(NearlyEqual(Target.Location.Z, 200.0f - Rules::HangHeightOffset));
+	CLIMB_CHECK(SameAngle(Target.Rotation.Yaw, 0.0f));
+	CLIMB_CHECK(NearlyEqual(Target.Rotation.Pitch, 0.0f));
+	CLIMB_CHECK(Target.Rotation.Roll == 0.0f);
+
+	//Wall along -Y: the character faces -Y, yaw -90.
+	Input.WallLocation	= { 0.0f, -80.0f, 0.0f };
+	Input.WallNormal	= { 0.0f, 1.0f, 0.0f };
+	Input.LedgeHeight	= -30.0f;
+
+	Target = ComputeGrabTarget(Input);
+
+	CLIMB_CHECK(NearlyEqual(Target.Location.X, 0.0f));
+	CLIMB_CHECK(NearlyEqual(Target.Location.Y, -80.0f + Rules::HangWallOffset));
+	CLIMB_CHECK(NearlyEqual(Target.Location.Z, -30.0f - Rules::HangHeightOffset));
+	CLIMB_CHECK(SameAngle(Target.Rotation.Yaw, -90.0f));
+
+	//Only the ledge height decides Z, not where the wall was hit.
+	Input.WallLocation.Z = 1000.0f;
+	CLIMB_CHECK(NearlyEqual(ComputeGrabTarget(Input).Location.Z, Target.Location.Z));
+
+	//A wall leaning back tilts the character by the normal pitch.
+	Input.WallNormal = { 0.0f, 0.7071068f, 0.7071068f };
+	CLIMB_CHECK(NearlyEqual(ComputeGrabTarget(Input).Rotation.Pitch, 45.0f));
+}
+
+static void TestIsPelvisInGrabRange()
+{
+	CLIMB_CHECK(IsPelvisInGrabRange(180.0f, 200.0f));
+	CLIMB_CHECK(IsPelvisInGrabRange(200.0f + Rules::PelvisRangeMax, 200.0f));
+	CLIMB_CHECK(IsPelvisInGrabRange(200.0f + Rules::PelvisRangeMin, 200.0f));
+
+	CLIMB_CHECK(!IsPelvisInGrabRange(200.0f + Rules::PelvisRangeMax + 0.5f, 200.0f));
+	CLIMB_CHECK(!IsPelvisInGrabRange(200.0f + Rules::PelvisRangeMin - 0.5f, 200.0f));
+	CLIMB_CHECK(!IsPelvisInGrabRange(0.0f, 200.0f));
+	CLIMB_CHECK(!IsPelvisInGrabRange(400.0f, 200.0f));
+}
+
+//*******************************************************************************************************************
+//		JUMP
+//*******************************************************************************************************************
+
+static void TestDecideJumpAction()
+{
+	FJumpInput Input;
+
+	//On the floor or falling, Jump is a plain jump whatever else is set.
+	Input.bCanJumpRight = true;
+	Input.MoveRightAxis = 1.0f;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::Jump);
+
+	//Turned back: jump away from the wall, unless already jumping.
+	Input = Hanging();
+	Input.bTurnedBack = true;
+	Input.bCanJumpRight = true;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::JumpBack);
+	Input.bIsJumping = true;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::None);
+
+	//Right side jump only while pushing right, otherwise climb on top.
+	Input = Hanging();
+	Input.bCanJumpRight = true;
+	Input.MoveRightAxis = 1.0f;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::JumpRight);
+	Input.bIsJumping = true;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::None);
+	Input.bIsJumping = false;
+	Input.MoveRightAxis = 0.0f;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::ClimbLedge);
+	Input.MoveRightAxis = -1.0f;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::ClimbLedge);
+
+	//With both sides open the right one is asked first, so pushing left climbs instead of jumping left.
+	Input.bCanJumpLeft = true;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::ClimbLedge);
+
+	//Left side jump only while pushing left.
+	Input = Hanging();
+	Input.bCanJumpLeft = true;
+	Input.MoveRightAxis = -1.0f;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::JumpLeft);
+	Input.bIsJumping = true;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::None);
+	Input.bIsJumping = false;
+	Input.MoveRightAxis = 1.0f;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::ClimbLedge);
+
+	//Jump up only standing still on the ledge and not already jumping.
+	Input = Hanging();
+	Input.bCanJumpUp = true;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::JumpUp);
+	Input.MoveRightAxis = 0.5f;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::None);
+	Input.MoveRightAxis = 0.0f;
+	Input.bIsJumping = true;
+	CLIMB_CHECK(DecideJumpAction(Input) == EJumpAction::None);
+
+	//Nothing else to do: climb on top.
+	CLIMB_CHECK(DecideJumpAction(Hanging()) == EJumpAction::ClimbLedge);
+}
+
+//*******************************************************************************************************************
+//		SIDES
+//*******************************************************************************************************************
+
+static void TestEvaluateSide()
+{
+	//Free to shimmy: no jump and no corner, whatever the other probes say.
+	for (int Probes = 0; Probes < 4; Probes++)
+	{
+		const FSideOptions Options = EvaluateSide(true, (Probes & 1) != 0, (Probes & 2) != 0);
+		CLIMB_CHECK(!Options.bCanJump && !Options.bCanTurn);
+	}
+
+	//Blocked, with a ledge further out: side jump, the corner is not looked at.
+	FSideOptions Options = EvaluateSide(false, true, false);
+	CLIMB_CHECK(Options.bCanJump && !Options.bCanTurn);
+	Options = EvaluateSide(false, true, true);
+	CLIMB_CHECK(Options.bCanJump && !Options.bCanTurn);
+
+	//Blocked, no ledge and the corner probe hits: the wall goes on, nothing to do.
+	Options = EvaluateSide(false, false, true);
+	CLIMB_CHECK(!Options.bCanJump && !Options.bCanTurn);
+
+	//Blocked, no ledge and the corner probe misses: the wall turns, take the corner.
+	Options = EvaluateSide(false, false, false);
+	CLIMB_CHECK(!Options.bCanJump && Options.bCanTurn);
+}
+
+int main()
+{
+	TestComputeGrabTarget();
+	TestIsPelvisInGrabRange();
+	TestDecideJumpAction();
+	TestEvaluateSide();
+
+	std::printf("ClimbCore: %d checks, %d failed\n", NumChecks, NumFailures);
+	return NumFailures == 0 ? 0 : 1;
+}